@@ -0,0 +1,157 @@
+#include "utils/MovementKernel.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <random>
+
+// Compares the scalar movement loop with the structure-of-arrays kernel, single-threaded, on movers laid out like
+// the game's: components in entity order, reversed paths in one contiguous waypoint arena.
+namespace
+{
+constexpr int moverCount = 10000;
+constexpr int waypointsPerPath = 40;
+constexpr int tickCount = 1000;
+constexpr int runCount = 5;
+constexpr float movementPerTick = 0.05f;
+
+struct Mover
+{
+    int pathOffset;
+    int remainingWaypoints;
+};
+
+struct World
+{
+    std::vector<PositionComponent> positions;
+    std::vector<Mover> movers;
+};
+
+span<const glm::vec2> RemainingWaypoints(const std::vector<glm::vec2>& waypoints, const Mover& mover)
+{
+    return span<const glm::vec2>(waypoints.data() + mover.pathOffset, mover.remainingWaypoints);
+}
+
+void CreateWorld(World& world, std::vector<glm::vec2>& waypoints)
+{
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> coordinate(0.f, 200.f);
+    std::uniform_real_distribution<float> offset(-2.f, 2.f);
+    for (int i = 0; i < moverCount; i++)
+    {
+        glm::vec2 position(coordinate(random), coordinate(random));
+        world.positions.push_back({.position = position});
+        world.movers.push_back({static_cast<int>(waypoints.size()), waypointsPerPath});
+        std::vector<glm::vec2> path;
+        for (int j = 0; j < waypointsPerPath; j++)
+        {
+            position += glm::vec2(offset(random), offset(random));
+            path.push_back(position);
+        }
+        waypoints.insert(waypoints.end(), path.rbegin(), path.rend());
+    }
+}
+
+void ScalarTick(World& world, const std::vector<glm::vec2>& waypoints)
+{
+    for (int i = 0; i < moverCount; i++)
+    {
+        Mover& mover = world.movers[i];
+        if (mover.remainingWaypoints > 0)
+        {
+            mover.remainingWaypoints =
+                MoveAlongPath(world.positions[i], RemainingWaypoints(waypoints, mover), movementPerTick);
+        }
+    }
+}
+
+void StepBlock(World& world, const std::vector<glm::vec2>& waypoints, MoverBlock& block, const int* blockMovers)
+{
+    block.StepTowardWaypoints(movementPerTick);
+    for (int j = 0; j < block.Count(); j++)
+    {
+        const int i = blockMovers[j];
+        if (!block.ReachesWaypoint(j))
+        {
+            block.Get(j, world.positions[i]);
+            continue;
+        }
+
+        Mover& mover = world.movers[i];
+        mover.remainingWaypoints =
+            MoveAlongPath(world.positions[i], RemainingWaypoints(waypoints, mover), movementPerTick);
+    }
+    block.Clear();
+}
+
+// Same gather, step and scatter as MovingEntitiesUpdater.
+void KernelTick(World& world, const std::vector<glm::vec2>& waypoints)
+{
+    MoverBlock block;
+    int blockMovers[MOVER_BLOCK_SIZE];
+    for (int i = 0; i < moverCount; i++)
+    {
+        const Mover& mover = world.movers[i];
+        if (mover.remainingWaypoints == 0)
+            continue;
+
+        blockMovers[block.Count()] = i;
+        block.Add(world.positions[i], waypoints[mover.pathOffset + mover.remainingWaypoints - 1]);
+        if (block.IsFull())
+            StepBlock(world, waypoints, block, blockMovers);
+    }
+    if (block.Count() > 0)
+        StepBlock(world, waypoints, block, blockMovers);
+}
+
+template <class Function>
+double MicrosecondsPerTick(const Function& tick)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < tickCount; i++)
+        tick();
+    const std::chrono::duration<double, std::micro> duration = std::chrono::steady_clock::now() - start;
+    return duration.count() / tickCount;
+}
+
+bool SameBits(const World& a, const World& b)
+{
+    for (int i = 0; i < moverCount; i++)
+    {
+        if (std::memcmp(&a.positions[i], &b.positions[i], sizeof(PositionComponent)) != 0 ||
+            a.movers[i].remainingWaypoints != b.movers[i].remainingWaypoints)
+            return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main()
+{
+    std::vector<glm::vec2> waypoints;
+    World startWorld;
+    CreateWorld(startWorld, waypoints);
+
+    // Best of several alternated runs, to leave out what other processes cost.
+    double scalarTime = 0.;
+    double kernelTime = 0.;
+    bool identical = true;
+    for (int run = 0; run < runCount; run++)
+    {
+        World scalarWorld = startWorld;
+        World kernelWorld = startWorld;
+        const double scalarRunTime = MicrosecondsPerTick([&]() { ScalarTick(scalarWorld, waypoints); });
+        const double kernelRunTime = MicrosecondsPerTick([&]() { KernelTick(kernelWorld, waypoints); });
+        scalarTime = run == 0 ? scalarRunTime : std::min(scalarTime, scalarRunTime);
+        kernelTime = run == 0 ? kernelRunTime : std::min(kernelTime, kernelRunTime);
+        identical = identical && SameBits(scalarWorld, kernelWorld);
+    }
+
+    std::cout << moverCount << " movers, " << tickCount << " ticks, best of " << runCount << " runs" << std::endl;
+    std::cout << "scalar: " << scalarTime << " us/tick" << std::endl;
+    std::cout << "kernel: " << kernelTime << " us/tick" << std::endl;
+    std::cout << "speedup: " << scalarTime / kernelTime << "x" << std::endl;
+    std::cout << "results: " << (identical ? "bit-identical" : "DIFFERENT") << std::endl;
+    return identical ? 0 : 1;
+}
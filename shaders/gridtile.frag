@@ -0,0 +1,28 @@
+#version 300 es
+
+precision mediump float;
+
+// World coordinates: mediump would lose the fraction drawing the grid far from the origin.
+in highp vec2 textureCoord;
+in vec3 normal;
+
+uniform sampler2D uniTexture;
+uniform float uniGridOpacity;
+
+out vec4 fragColor;
+
+const vec3 lightDir = vec3(-0.3, 0.2, -0.6);
+const vec3 gridColor = vec3(0.2, 0.2, 0.2);
+
+void main()
+{
+    float cosAngle = dot(normal, -normalize(lightDir));
+    float lightPower = cosAngle > 0.0 ? cosAngle : 0.0;
+    fragColor = texture(uniTexture, textureCoord);
+    fragColor.rgb *= mix(0.5, 1.0, lightPower);
+
+    // Tiles are bounded by integer coordinates: distance to the nearest edge, in pixels, for one pixel wide lines.
+    vec2 edgeDistance = abs(fract(textureCoord - 0.5) - 0.5) / fwidth(textureCoord);
+    float line = 1.0 - clamp(min(edgeDistance.x, edgeDistance.y), 0.0, 1.0);
+    fragColor.rgb = mix(fragColor.rgb, gridColor, line * uniGridOpacity);
+}
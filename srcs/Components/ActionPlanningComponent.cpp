@@ -0,0 +1,24 @@
+#include "ActionPlanningComponent.hpp"
+
+#include "hatcher/DataLoader.hpp"
+#include "hatcher/DataSaver.hpp"
+
+#include "utils/SaveFormat.hpp"
+
+void operator<<(DataSaver& saver, const ActionPlanningComponent& component)
+{
+    SaveFormat::WriteVersion(saver);
+    saver << component.agenda;
+    saver << component.currentActionIndex;
+    saver << component.lockedEntity;
+    saver << component.lockedStack;
+}
+
+void operator>>(DataLoader& loader, ActionPlanningComponent& component)
+{
+    SaveFormat::CheckVersion(loader);
+    loader >> component.agenda;
+    loader >> component.currentActionIndex;
+    loader >> component.lockedEntity;
+    loader >> component.lockedStack;
+}
@@ -3,6 +3,13 @@
 #include <optional>
 
 #include "hatcher/Entity.hpp"
+#include "hatcher/Maths/glm_pure.hpp"
+
+namespace hatcher
+{
+class DataLoader;
+class DataSaver;
+} // namespace hatcher
 
 using namespace hatcher;
 
@@ -17,4 +24,9 @@ struct ActionPlanningComponent
     EAgenda agenda = EAgenda::Derp;
     std::optional<int> currentActionIndex;
     std::optional<Entity> lockedEntity;
+    // Position of the ground stack locked, as stacks have no entity.
+    std::optional<glm::vec2> lockedStack;
 };
+
+void operator<<(DataSaver& saver, const ActionPlanningComponent& component);
+void operator>>(DataLoader& loader, ActionPlanningComponent& component);
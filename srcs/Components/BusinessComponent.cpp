@@ -3,16 +3,28 @@
 #include "hatcher/DataLoader.hpp"
 #include "hatcher/DataSaver.hpp"
 
+#include "utils/SaveFormat.hpp"
+
 void operator<<(DataSaver& saver, const BusinessComponent& component)
 {
-    saver << component.storagePosition;
-    saver << component.agenda;
+    SaveFormat::WriteVersion(saver);
+    saver << component.traits->storagePosition;
+    saver << component.traits->agenda;
     saver << component.employees;
+    saver << component.traits->maxEmployees;
+    saver << component.stockpile.position;
+    saver << component.stockpile.resources;
 }
 
 void operator>>(DataLoader& loader, BusinessComponent& component)
 {
-    loader >> component.storagePosition;
-    loader >> component.agenda;
+    BusinessComponent::Traits traits;
+    SaveFormat::CheckVersion(loader);
+    loader >> traits.storagePosition;
+    loader >> traits.agenda;
     loader >> component.employees;
+    loader >> traits.maxEmployees;
+    loader >> component.stockpile.position;
+    loader >> component.stockpile.resources;
+    component.traits = traits;
 }
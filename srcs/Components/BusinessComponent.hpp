@@ -1,11 +1,15 @@
 #pragma once
 
+#include <limits>
 #include <vector>
 
 #include "hatcher/Entity.hpp"
 #include "hatcher/Maths/glm_pure.hpp"
 
 #include "ActionPlanningComponent.hpp"
+#include "ResourceStack.hpp"
+
+#include "utils/Shared.hpp"
 
 namespace hatcher
 {
@@ -17,9 +21,30 @@ using namespace hatcher;
 
 struct BusinessComponent
 {
-    glm::vec2 storagePosition;
-    ActionPlanningComponent::EAgenda agenda;
+    struct Traits
+    {
+        glm::vec2 storagePosition;
+        ActionPlanningComponent::EAgenda agenda;
+        int maxEmployees = std::numeric_limits<int>::max();
+
+        bool operator==(const Traits& other) const
+        {
+            return storagePosition == other.storagePosition && agenda == other.agenda &&
+                   maxEmployees == other.maxEmployees;
+        }
+    };
+
+    // What the business stored, on its storage tile. Kept here rather than on the ground, so that dropping off
+    // or reading the stock needs no search.
+    struct Stockpile
+    {
+        glm::vec2 position;
+        ResourceStacks resources;
+    };
+
+    Shared<Traits> traits;
     std::vector<Entity> employees;
+    Stockpile stockpile;
 };
 
 void operator<<(DataSaver& saver, const BusinessComponent& component);
@@ -0,0 +1,24 @@
+#include "GrowableComponent.hpp"
+
+#include "hatcher/DataLoader.hpp"
+#include "hatcher/DataSaver.hpp"
+
+#include "utils/SaveFormat.hpp"
+
+using namespace hatcher;
+
+void operator<<(DataSaver& saver, const GrowableComponent& component)
+{
+    SaveFormat::WriteVersion(saver);
+    saver << component.initialMaturity;
+    saver << component.growthTime;
+    saver << component.plantingTick;
+}
+
+void operator>>(DataLoader& loader, GrowableComponent& component)
+{
+    SaveFormat::CheckVersion(loader);
+    loader >> component.initialMaturity;
+    loader >> component.growthTime;
+    loader >> component.plantingTick;
+}
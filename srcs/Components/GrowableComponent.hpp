@@ -1,7 +1,26 @@
 #pragma once
 
+#include <algorithm>
+
+namespace hatcher
+{
+class DataLoader;
+class DataSaver;
+} // namespace hatcher
+
 struct GrowableComponent
 {
-    float maturity;
+    float initialMaturity;
     int growthTime;
+    int plantingTick = 0; // Set on creation.
 };
+
+void operator<<(hatcher::DataSaver& saver, const GrowableComponent& component);
+void operator>>(hatcher::DataLoader& loader, GrowableComponent& component);
+
+// Maturity is a pure function of time, so growing costs nothing until someone looks.
+inline float GetMaturity(const GrowableComponent& growable, int currentTick)
+{
+    const float grownTicks = static_cast<float>(currentTick - growable.plantingTick);
+    return std::min(growable.initialMaturity + grownTicks / static_cast<float>(growable.growthTime), 1.f);
+}
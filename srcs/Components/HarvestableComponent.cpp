@@ -0,0 +1,24 @@
+#include "Components/HarvestableComponent.hpp"
+
+#include "hatcher/DataLoader.hpp"
+#include "hatcher/DataSaver.hpp"
+
+#include "utils/SaveFormat.hpp"
+
+void operator<<(DataSaver& saver, const HarvestableComponent& component)
+{
+    SaveFormat::WriteVersion(saver);
+    saver << static_cast<int>(component.traits->harvest);
+    saver << component.traits->amount;
+}
+
+void operator>>(DataLoader& loader, HarvestableComponent& component)
+{
+    SaveFormat::CheckVersion(loader);
+    HarvestableComponent::Traits traits;
+    int harvest;
+    loader >> harvest;
+    traits.harvest = static_cast<EResource>(harvest);
+    loader >> traits.amount;
+    component.traits = traits;
+}
@@ -1,11 +1,28 @@
 #pragma once
 
-#include "hatcher/EntityDescriptorID.hpp"
+#include "Components/ResourceStack.hpp"
+#include "utils/Shared.hpp"
+
+namespace hatcher
+{
+class DataLoader;
+class DataSaver;
+} // namespace hatcher
 
 using namespace hatcher;
 
 struct HarvestableComponent
 {
-    EntityDescriptorID harvest;
-    int amount = 5;
+    struct Traits
+    {
+        EResource harvest;
+        int amount = 5;
+
+        bool operator==(const Traits& other) const { return harvest == other.harvest && amount == other.amount; }
+    };
+
+    Shared<Traits> traits;
 };
+
+void operator<<(DataSaver& saver, const HarvestableComponent& component);
+void operator>>(DataLoader& loader, HarvestableComponent& component);
@@ -1,14 +1,26 @@
 #include "Components/InventoryComponent.hpp"
 
+#include <vector>
+
 #include "hatcher/DataLoader.hpp"
 #include "hatcher/DataSaver.hpp"
 
+#include "utils/SaveFormat.hpp"
+
 void operator<<(DataSaver& saver, const InventoryComponent& component)
 {
-    saver << component.storage;
+    SaveFormat::WriteVersion(saver);
+    const std::vector<Entity> storage(component.storage.begin(), component.storage.end());
+    saver << storage;
+    saver << component.resources;
 }
 
 void operator>>(DataLoader& loader, InventoryComponent& component)
 {
-    loader >> component.storage;
+    SaveFormat::CheckVersion(loader);
+    std::vector<Entity> storage;
+    loader >> storage;
+    component.storage.assign(storage.begin(), storage.end());
+    component.resources.clear();
+    loader >> component.resources;
 }
@@ -1,9 +1,10 @@
 #pragma once
 
-#include <vector>
-
 #include "hatcher/Entity.hpp"
 
+#include "Components/ResourceStack.hpp"
+#include "utils/SmallVector.hpp"
+
 namespace hatcher
 {
 class DataLoader;
@@ -14,7 +15,9 @@ using namespace hatcher;
 
 struct InventoryComponent
 {
-    std::vector<Entity> storage;
+    // Inline for the usual handful of items: a Steve's axe, a rack's axes.
+    SmallVector<Entity, 4> storage;
+    ResourceStacks resources;
 };
 
 void operator<<(DataSaver& saver, const InventoryComponent& component);
@@ -0,0 +1,22 @@
+#include "ItemComponent.hpp"
+
+#include "hatcher/DataLoader.hpp"
+#include "hatcher/DataSaver.hpp"
+
+#include "utils/SaveFormat.hpp"
+
+void operator<<(DataSaver& saver, const ItemComponent& component)
+{
+    SaveFormat::WriteVersion(saver);
+    saver << static_cast<int>(component.type);
+    saver << component.inventory;
+}
+
+void operator>>(DataLoader& loader, ItemComponent& component)
+{
+    SaveFormat::CheckVersion(loader);
+    int type;
+    loader >> type;
+    component.type = static_cast<ItemComponent::EType>(type);
+    loader >> component.inventory;
+}
@@ -5,17 +5,28 @@
 
 #include "hatcher/Entity.hpp"
 
+namespace hatcher
+{
+class DataLoader;
+class DataSaver;
+} // namespace hatcher
+
 using namespace hatcher;
 
 struct ItemComponent
 {
     enum EType
     {
+        // Resources are counted in InventoryComponent::resources, this only keys where they are displayed.
         Resource,
         Tool,
+        COUNT,
     };
 
     EType type;
     std::optional<Entity> inventory;
-    int count = 1;
 };
+
+void operator<<(DataSaver& saver, const ItemComponent& component);
+void operator>>(DataLoader& loader, ItemComponent& component);
+
@@ -3,12 +3,18 @@
 #include "hatcher/DataLoader.hpp"
 #include "hatcher/DataSaver.hpp"
 
+#include "utils/SaveFormat.hpp"
+
 void operator<<(DataSaver& saver, const MovementComponent& component)
 {
-    saver << component.path;
+    SaveFormat::WriteVersion(saver);
+    saver << component.pathHandle;
+    saver << component.remainingWaypoints;
 }
 
 void operator>>(DataLoader& loader, MovementComponent& component)
 {
-    loader >> component.path;
+    SaveFormat::CheckVersion(loader);
+    loader >> component.pathHandle;
+    loader >> component.remainingWaypoints;
 }
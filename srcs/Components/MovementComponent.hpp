@@ -1,8 +1,5 @@
 #pragma once
 
-#include <glm/vec2.hpp>
-#include <vector>
-
 namespace hatcher
 {
 class DataLoader;
@@ -13,7 +10,8 @@ using namespace hatcher;
 
 struct MovementComponent
 {
-    std::vector<glm::vec2> path; // Reversed : last element is the next step.
+    int pathHandle = -1; // In the PathPool, which stores the path reversed : last element is the next step.
+    int remainingWaypoints = 0;
 };
 
 void operator<<(DataSaver& saver, const MovementComponent& component);
@@ -0,0 +1,18 @@
+#include "Components/ObstacleComponent.hpp"
+
+#include "hatcher/DataLoader.hpp"
+#include "hatcher/DataSaver.hpp"
+
+void operator<<(DataSaver& saver, const ObstacleComponent& component)
+{
+    saver << component.traits->area.Min();
+    saver << component.traits->area.Max();
+}
+
+void operator>>(DataLoader& loader, ObstacleComponent& component)
+{
+    glm::ivec2 min, max;
+    loader >> min;
+    loader >> max;
+    component.traits = ObstacleComponent::Traits{.area = Box2i(min, max)};
+}
@@ -2,9 +2,30 @@
 
 #include "hatcher/Maths/Box.hpp"
 
+#include "utils/Shared.hpp"
+
+namespace hatcher
+{
+class DataLoader;
+class DataSaver;
+} // namespace hatcher
+
 using namespace hatcher;
 
 struct ObstacleComponent
 {
-    Box2i area;
+    struct Traits
+    {
+        Box2i area;
+
+        bool operator==(const Traits& other) const
+        {
+            return area.Min() == other.area.Min() && area.Max() == other.area.Max();
+        }
+    };
+
+    Shared<Traits> traits;
 };
+
+void operator<<(DataSaver& saver, const ObstacleComponent& component);
+void operator>>(DataLoader& loader, ObstacleComponent& component);
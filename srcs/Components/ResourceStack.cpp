@@ -0,0 +1,69 @@
+#include "Components/ResourceStack.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "hatcher/DataLoader.hpp"
+#include "hatcher/DataSaver.hpp"
+
+using namespace hatcher;
+
+namespace
+{
+auto FindStack(ResourceStacks& stacks, EResource resource)
+{
+    const auto IsResource = [resource](const ResourceStack& stack) { return stack.resource == resource; };
+    return std::find_if(stacks.begin(), stacks.end(), IsResource);
+}
+} // namespace
+
+int ResourceCount(const ResourceStacks& stacks, EResource resource)
+{
+    for (const ResourceStack& stack : stacks)
+    {
+        if (stack.resource == resource)
+            return stack.count;
+    }
+    return 0;
+}
+
+void AddResource(ResourceStacks& stacks, EResource resource, int count)
+{
+    const auto it = FindStack(stacks, resource);
+    if (it == stacks.end())
+        stacks.push_back({resource, count});
+    else
+        it->count += count;
+}
+
+int TakeResource(ResourceStacks& stacks, EResource resource)
+{
+    const auto it = FindStack(stacks, resource);
+    if (it == stacks.end())
+        return 0;
+    const int count = it->count;
+    stacks.erase(it);
+    return count;
+}
+
+void operator<<(DataSaver& saver, const ResourceStacks& stacks)
+{
+    std::vector<int> resources, counts;
+    for (const ResourceStack& stack : stacks)
+    {
+        resources.push_back(static_cast<int>(stack.resource));
+        counts.push_back(stack.count);
+    }
+    saver << resources;
+    saver << counts;
+}
+
+void operator>>(DataLoader& loader, ResourceStacks& stacks)
+{
+    std::vector<int> resources, counts;
+    loader >> resources;
+    loader >> counts;
+    stacks.clear();
+    for (std::size_t i = 0; i < resources.size(); i++)
+        stacks.push_back({static_cast<EResource>(resources[i]), counts[i]});
+}
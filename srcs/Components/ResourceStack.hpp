@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+
+#include "utils/SmallVector.hpp"
+
+namespace hatcher
+{
+class DataLoader;
+class DataSaver;
+} // namespace hatcher
+
+// Bulk resources have no entity identity: they are only counted, in inventories and on the ground.
+enum class EResource
+{
+    Wood,
+    COUNT,
+};
+
+struct ResourceStack
+{
+    EResource resource;
+    int count;
+};
+
+// At most one stack per resource, so never on the heap.
+using ResourceStacks = SmallVector<ResourceStack, static_cast<std::size_t>(EResource::COUNT)>;
+
+int ResourceCount(const ResourceStacks& stacks, EResource resource);
+void AddResource(ResourceStacks& stacks, EResource resource, int count);
+// Empties the stack of this resource, returning how many there were.
+int TakeResource(ResourceStacks& stacks, EResource resource);
+
+void operator<<(hatcher::DataSaver& saver, const ResourceStacks& stacks);
+void operator>>(hatcher::DataLoader& loader, ResourceStacks& stacks);
+
+inline const char* ResourceName(EResource resource)
+{
+    switch (resource)
+    {
+    case EResource::Wood:
+        return "Wood";
+    default:
+        return "Unknown";
+    }
+}
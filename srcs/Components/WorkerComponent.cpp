@@ -0,0 +1,24 @@
+#include "WorkerComponent.hpp"
+
+#include "hatcher/DataLoader.hpp"
+#include "hatcher/DataSaver.hpp"
+
+#include "utils/SaveFormat.hpp"
+
+void operator<<(DataSaver& saver, const WorkerComponent& component)
+{
+    SaveFormat::WriteVersion(saver);
+    saver << component.workIndex;
+    saver << component.target;
+    saver << component.workTimer.index;
+    saver << component.workTimer.generation;
+}
+
+void operator>>(DataLoader& loader, WorkerComponent& component)
+{
+    SaveFormat::CheckVersion(loader);
+    loader >> component.workIndex;
+    loader >> component.target;
+    loader >> component.workTimer.index;
+    loader >> component.workTimer.generation;
+}
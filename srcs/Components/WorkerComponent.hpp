@@ -4,6 +4,14 @@
 
 #include "hatcher/Entity.hpp"
 
+#include "WorldComponents/TimerHandle.hpp"
+
+namespace hatcher
+{
+class DataLoader;
+class DataSaver;
+} // namespace hatcher
+
 using namespace hatcher;
 
 enum class EWork
@@ -15,6 +23,8 @@ struct WorkerComponent
 {
     std::optional<EWork> workIndex;
     std::optional<Entity> target;
-    int workedTicks = 0;
-    int workLength = 0;
+    TimerHandle workTimer;
 };
+
+void operator<<(DataSaver& saver, const WorkerComponent& component);
+void operator>>(DataLoader& loader, WorkerComponent& component);
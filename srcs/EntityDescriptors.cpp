@@ -18,6 +18,8 @@
 #include "RenderComponents/SelectableComponent.hpp"
 #include "RenderComponents/StaticMeshComponent.hpp"
 #include "RenderComponents/SteveAnimationComponent.hpp"
+#include "RenderComponents/TransformComponent.hpp"
+#include "utils/GameComponentRegisterer.hpp"
 #include "utils/TimeOfDay.hpp"
 
 using namespace hatcher;
@@ -25,24 +27,25 @@ using namespace hatcher;
 namespace
 {
 
-ComponentTypeRegisterer<ActionPlanningComponent, EComponentList::Gameplay> actionPlanningRegisterer;
-ComponentTypeRegisterer<BusinessComponent, EComponentList::Gameplay> businessRegisterer;
-ComponentTypeRegisterer<EmployableComponent, EComponentList::Gameplay> employableRegisterer;
-ComponentTypeRegisterer<GrowableComponent, EComponentList::Gameplay> growableRegisterer;
-ComponentTypeRegisterer<InventoryComponent, EComponentList::Gameplay> inventoryRegisterer;
-ComponentTypeRegisterer<HarvestableComponent, EComponentList::Gameplay> harvestableRegisterer;
-ComponentTypeRegisterer<ItemComponent, EComponentList::Gameplay> itemRegisterer;
-ComponentTypeRegisterer<LockableComponent, EComponentList::Gameplay> lockableRegisterer;
-ComponentTypeRegisterer<MovementComponent, EComponentList::Gameplay> movement2DRegisterer;
-ComponentTypeRegisterer<NameComponent, EComponentList::Gameplay> nameRegisterer;
-ComponentTypeRegisterer<ObstacleComponent, EComponentList::Gameplay> obstacleRegisterer;
-ComponentTypeRegisterer<PositionComponent, EComponentList::Gameplay> position2DRegisterer;
-ComponentTypeRegisterer<WorkerComponent, EComponentList::Gameplay> workerRegisterer;
+GameComponentRegisterer<ActionPlanningComponent, EComponentList::Gameplay> actionPlanningRegisterer("ActionPlanning");
+GameComponentRegisterer<BusinessComponent, EComponentList::Gameplay> businessRegisterer("Business");
+GameComponentRegisterer<EmployableComponent, EComponentList::Gameplay> employableRegisterer("Employable");
+GameComponentRegisterer<GrowableComponent, EComponentList::Gameplay> growableRegisterer("Growable");
+GameComponentRegisterer<InventoryComponent, EComponentList::Gameplay> inventoryRegisterer("Inventory");
+GameComponentRegisterer<HarvestableComponent, EComponentList::Gameplay> harvestableRegisterer("Harvestable");
+GameComponentRegisterer<ItemComponent, EComponentList::Gameplay> itemRegisterer("Item");
+GameComponentRegisterer<LockableComponent, EComponentList::Gameplay> lockableRegisterer("Lockable");
+GameComponentRegisterer<MovementComponent, EComponentList::Gameplay> movement2DRegisterer("Movement");
+GameComponentRegisterer<NameComponent, EComponentList::Gameplay> nameRegisterer("Name");
+GameComponentRegisterer<ObstacleComponent, EComponentList::Gameplay> obstacleRegisterer("Obstacle");
+GameComponentRegisterer<PositionComponent, EComponentList::Gameplay> position2DRegisterer("Position");
+GameComponentRegisterer<WorkerComponent, EComponentList::Gameplay> workerRegisterer("Worker");
 
-ComponentTypeRegisterer<ItemDisplayComponent, EComponentList::Rendering> itemDisplayRegisterer;
-ComponentTypeRegisterer<SelectableComponent, EComponentList::Rendering> selectableRegisterer;
-ComponentTypeRegisterer<StaticMeshComponent, EComponentList::Rendering> staticMeshRegisterer;
-ComponentTypeRegisterer<SteveAnimationComponent, EComponentList::Rendering> steveAnimationRegisterer;
+GameComponentRegisterer<ItemDisplayComponent, EComponentList::Rendering> itemDisplayRegisterer("ItemDisplay");
+GameComponentRegisterer<SelectableComponent, EComponentList::Rendering> selectableRegisterer("Selectable");
+GameComponentRegisterer<StaticMeshComponent, EComponentList::Rendering> staticMeshRegisterer("StaticMesh");
+GameComponentRegisterer<SteveAnimationComponent, EComponentList::Rendering> steveAnimationRegisterer("SteveAnimation");
+GameComponentRegisterer<TransformComponent, EComponentList::Rendering> transformRegisterer("Transform");
 
 EntityDescriptorRegisterer Axe{
     EntityDescriptorID::Create("Axe"),
@@ -59,6 +62,7 @@ EntityDescriptorRegisterer Axe{
         StaticMeshComponent{
             .type = StaticMeshComponent::Axe,
         },
+        TransformComponent{},
     },
 };
 
@@ -66,14 +70,18 @@ EntityDescriptorRegisterer LoggingHut{
     EntityDescriptorID::Create("LoggingHut"),
     {
         BusinessComponent{
-            .storagePosition = {1.f, 2.f},
-            .agenda = ActionPlanningComponent::EAgenda::Lumberjack,
+            .traits =
+                BusinessComponent::Traits{
+                    .storagePosition = {1.f, 2.f},
+                    .agenda = ActionPlanningComponent::EAgenda::Lumberjack,
+                    .maxEmployees = 3,
+                },
         },
         NameComponent{
             .name = "Logging Hut",
         },
         ObstacleComponent{
-            .area = Box2i(glm::ivec2(-1, -1), glm::ivec2(1, 1)),
+            .traits = ObstacleComponent::Traits{.area = Box2i(glm::ivec2(-1, -1), glm::ivec2(1, 1))},
         },
         PositionComponent{},
     },
@@ -82,6 +90,7 @@ EntityDescriptorRegisterer LoggingHut{
         StaticMeshComponent{
             .type = StaticMeshComponent::Hut,
         },
+        TransformComponent{},
     },
 };
 
@@ -92,7 +101,7 @@ EntityDescriptorRegisterer Melon{
             .name = "Melon",
         },
         GrowableComponent{
-            .maturity = 0.25,
+            .initialMaturity = 0.25,
             .growthTime = HoursToTicks(1.f),
         },
         PositionComponent{},
@@ -101,24 +110,25 @@ EntityDescriptorRegisterer Melon{
         StaticMeshComponent{
             .type = StaticMeshComponent::Melon,
         },
+        TransformComponent{},
     },
 };
 
 // Would be constexpr if the glm was...
-ItemDisplayComponent::Locations RackToolLocations()
+ItemDisplayComponent RackItemDisplay()
 {
-    ItemDisplayComponent::Locations rackItemLocations(10, &ItemDisplayComponent::LocationHash);
+    ItemDisplayComponent rackItemDisplay;
     glm::mat4 rackToolLocation(1.f);
     rackToolLocation = glm::translate(rackToolLocation, glm::vec3(0.08f, 0.3f, 0.f));
     rackToolLocation = glm::rotate(rackToolLocation, glm::radians(-10.f), glm::vec3(0.f, 1.f, 0.f));
-    rackItemLocations[std::make_pair(ItemComponent::Tool, 0)] = rackToolLocation;
+    rackItemDisplay.SetLocation(ItemComponent::Tool, 0, rackToolLocation);
     rackToolLocation = glm::translate(rackToolLocation, glm::vec3(0.f, -0.2f, 0.f));
-    rackItemLocations[std::make_pair(ItemComponent::Tool, 1)] = rackToolLocation;
+    rackItemDisplay.SetLocation(ItemComponent::Tool, 1, rackToolLocation);
     rackToolLocation = glm::translate(rackToolLocation, glm::vec3(0.f, -0.2f, 0.f));
-    rackItemLocations[std::make_pair(ItemComponent::Tool, 2)] = rackToolLocation;
+    rackItemDisplay.SetLocation(ItemComponent::Tool, 2, rackToolLocation);
     rackToolLocation = glm::translate(rackToolLocation, glm::vec3(0.f, -0.2f, 0.f));
-    rackItemLocations[std::make_pair(ItemComponent::Tool, 3)] = rackToolLocation;
-    return rackItemLocations;
+    rackItemDisplay.SetLocation(ItemComponent::Tool, 3, rackToolLocation);
+    return rackItemDisplay;
 }
 
 EntityDescriptorRegisterer Rack{
@@ -126,16 +136,17 @@ EntityDescriptorRegisterer Rack{
     {
         InventoryComponent{},
         ObstacleComponent{
-            .area = Box2i(glm::ivec2(0, 0)),
+            .traits = ObstacleComponent::Traits{.area = Box2i(glm::ivec2(0, 0))},
         },
         PositionComponent{},
     },
     {
-        ItemDisplayComponent{.locations = RackToolLocations()},
+        RackItemDisplay(),
         SelectableComponent{},
         StaticMeshComponent{
             .type = StaticMeshComponent::Rack,
         },
+        TransformComponent{},
     },
 };
 
@@ -156,6 +167,7 @@ EntityDescriptorRegisterer Steve{
         ItemDisplayComponent{},
         SelectableComponent{},
         SteveAnimationComponent{},
+        TransformComponent{},
     },
 };
 
@@ -166,16 +178,19 @@ EntityDescriptorRegisterer Tree{
             .name = "Tree",
         },
         GrowableComponent{
-            .maturity = 0.25,
+            .initialMaturity = 0.25,
             .growthTime = HoursToTicks(1.f),
         },
         HarvestableComponent{
-            .harvest = EntityDescriptorID::Create("Wood"),
-            .amount = 2,
+            .traits =
+                HarvestableComponent::Traits{
+                    .harvest = EResource::Wood,
+                    .amount = 2,
+                },
         },
         LockableComponent{},
         ObstacleComponent{
-            .area = Box2i(glm::ivec2(0, 0)),
+            .traits = ObstacleComponent::Traits{.area = Box2i(glm::ivec2(0, 0))},
         },
         PositionComponent{},
     },
@@ -183,25 +198,7 @@ EntityDescriptorRegisterer Tree{
         StaticMeshComponent{
             .type = StaticMeshComponent::Tree,
         },
-    },
-};
-
-EntityDescriptorRegisterer Wood{
-    EntityDescriptorID::Create("Wood"),
-    {
-        ItemComponent{
-            .type = ItemComponent::Resource,
-        },
-        EmployableComponent{},
-        LockableComponent{},
-        NameComponent{
-            .name = "Wood",
-        },
-    },
-    {
-        StaticMeshComponent{
-            .type = StaticMeshComponent::Wood,
-        },
+        TransformComponent{},
     },
 };
 
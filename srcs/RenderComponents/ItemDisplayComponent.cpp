@@ -1,29 +1,56 @@
 #include "ItemDisplayComponent.hpp"
 
+#include <vector>
+
 #include "hatcher/DataLoader.hpp"
 #include "hatcher/DataSaver.hpp"
+#include "hatcher/assert.hpp"
+
+#include "utils/SaveFormat.hpp"
 
 using namespace hatcher;
 
-template <>
-struct std::hash<ItemComponent::EType>
+const std::optional<glm::mat4>& ItemDisplayComponent::Location(ItemComponent::EType type, int slot) const
 {
-    size_t operator()(ItemComponent::EType type) const noexcept { return std::hash<int>{}(static_cast<int>(type)); }
-};
+    static const std::optional<glm::mat4> hidden;
+    HATCHER_ASSERT(type < ItemComponent::COUNT);
+    if (slot >= slotsPerType)
+        return hidden;
+    return locations[type * slotsPerType + slot];
+}
 
-size_t ItemDisplayComponent::LocationHash(LocationKey key)
+void ItemDisplayComponent::SetLocation(ItemComponent::EType type, int slot, const glm::mat4& location)
 {
-    size_t seed = std::hash<decltype(key.first)>{}(key.first);
-    seed ^= std::hash<decltype(key.second)>{}(key.second) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    return seed;
+    HATCHER_ASSERT(type < ItemComponent::COUNT);
+    HATCHER_ASSERT(slot < slotsPerType);
+    locations[type * slotsPerType + slot] = location;
 }
 
 void operator<<(DataSaver& saver, const ItemDisplayComponent& component)
 {
-    saver << component.locations;
+    std::vector<int> indices;
+    std::vector<glm::mat4> locations;
+    for (int index = 0; index < static_cast<int>(component.locations.size()); index++)
+    {
+        if (component.locations[index])
+        {
+            indices.push_back(index);
+            locations.push_back(*component.locations[index]);
+        }
+    }
+    SaveFormat::WriteVersion(saver);
+    saver << indices;
+    saver << locations;
 }
 
 void operator>>(DataLoader& loader, ItemDisplayComponent& component)
 {
-    loader >> component.locations;
+    std::vector<int> indices;
+    std::vector<glm::mat4> locations;
+    SaveFormat::CheckVersion(loader);
+    loader >> indices;
+    loader >> locations;
+    component.locations = {};
+    for (std::size_t i = 0; i < indices.size(); i++)
+        component.locations[indices[i]] = locations[i];
 }
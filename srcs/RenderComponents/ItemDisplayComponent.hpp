@@ -1,7 +1,7 @@
 #pragma once
 
-#include <unordered_map>
-#include <utility>
+#include <array>
+#include <optional>
 
 #include "hatcher/Maths/glm_pure.hpp"
 
@@ -15,12 +15,15 @@ class DataSaver;
 
 struct ItemDisplayComponent
 {
-    using LocationKey = std::pair<ItemComponent::EType, int>;
-    static size_t LocationHash(LocationKey key);
+    static constexpr int slotsPerType = 4;
 
-    using Locations = std::unordered_map<LocationKey, glm::mat4, decltype(&LocationHash)>;
-    Locations locations = Locations(10, &LocationHash);
+    // Where the slot-th item of this type is shown, relative to the holder. Items in empty slots are not shown.
+    const std::optional<glm::mat4>& Location(ItemComponent::EType type, int slot) const;
+    void SetLocation(ItemComponent::EType type, int slot, const glm::mat4& location);
+
+    // Indexed by type, then by slot.
+    std::array<std::optional<glm::mat4>, ItemComponent::COUNT * slotsPerType> locations;
 };
 
-void operator<<(DataSaver& saver, const ItemDisplayComponent& component);
-void operator>>(DataLoader& loader, ItemDisplayComponent& component);
+void operator<<(hatcher::DataSaver& saver, const ItemDisplayComponent& component);
+void operator>>(hatcher::DataLoader& loader, ItemDisplayComponent& component);
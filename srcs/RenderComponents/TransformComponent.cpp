@@ -0,0 +1,19 @@
+#include "TransformComponent.hpp"
+
+#include "hatcher/DataLoader.hpp"
+#include "hatcher/DataSaver.hpp"
+
+#include "utils/SaveFormat.hpp"
+
+using namespace hatcher;
+
+void operator<<(DataSaver& saver, const TransformComponent&)
+{
+    SaveFormat::WriteVersion(saver);
+}
+
+void operator>>(DataLoader& loader, TransformComponent& component)
+{
+    SaveFormat::CheckVersion(loader);
+    component = TransformComponent{};
+}
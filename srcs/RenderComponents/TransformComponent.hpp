@@ -0,0 +1,22 @@
+#pragma once
+
+#include "hatcher/Maths/glm_pure.hpp"
+
+namespace hatcher
+{
+class DataLoader;
+class DataSaver;
+} // namespace hatcher
+
+// Model matrix of the entity's PositionComponent, along with the position it was built from.
+// A zero orientation never matches a real one, so that a new component is built on its first refresh.
+struct TransformComponent
+{
+    glm::vec2 position = {0.f, 0.f};
+    glm::vec2 orientation = {0.f, 0.f};
+    glm::mat4 model = glm::mat4(1.f);
+};
+
+// Only the save version is kept: the matrix is rebuilt from the position on the first refresh after a load.
+void operator<<(hatcher::DataSaver& saver, const TransformComponent& component);
+void operator>>(hatcher::DataLoader& loader, TransformComponent& component);
@@ -58,8 +58,8 @@ public:
 
         HandleCameraMotion(camera, frameRenderer.GetClock());
 
-        frameRenderer.SetProjectionMatrix(CalculateProjectionMatrix(camera, frameRenderer));
-        frameRenderer.SetViewMatrix(glm::lookAt(camera->Position(), camera->Target(), camera->Up()));
+        frameRenderer.SetProjectionMatrix(camera->ProjectionMatrix(frameRenderer.Resolution()));
+        frameRenderer.SetViewMatrix(camera->ViewMatrix());
     }
 
 private:
@@ -88,21 +88,6 @@ private:
         cameraMovement *= movementAmplitude;
         camera->target += glm::vec3(cameraMovement, 0.f);
     }
-
-    glm::mat4 CalculateProjectionMatrix(const Camera* camera, const IFrameRenderer& frameRenderer) const
-    {
-        const glm::ivec2 resolution = frameRenderer.Resolution();
-        const float halfWidth = resolution.x / 2.f * camera->pixelSize;
-        const float halfHeight = resolution.y / 2.f * camera->pixelSize;
-
-        const float right = halfWidth;
-        const float left = -halfWidth;
-        const float bottom = -halfHeight;
-        const float top = halfHeight;
-        const float zNear = 0.1f;
-        const float zFar = 1000.f;
-        return glm::ortho(left, right, bottom, top, zNear, zFar);
-    }
 };
 
 EventListenerRegisterer<CameraEventListener> eventRegisterer;
@@ -0,0 +1,37 @@
+#include "RenderUpdaterOrder.hpp"
+
+#include "hatcher/ComponentAccessor.hpp"
+#include "hatcher/Graphics/RenderUpdater.hpp"
+
+#include "WorldComponents/ComponentIndex.hpp"
+
+using namespace hatcher;
+
+namespace
+{
+
+// Rendering has no deletion hook: entities which lost their render components are pruned at each frame.
+class ComponentIndexRenderUpdater final : public RenderUpdater
+{
+public:
+    ComponentIndexRenderUpdater(const IRendering* rendering) {}
+
+    void Update(IApplication* application, const ComponentAccessor* componentAccessor,
+                ComponentAccessor* renderComponentAccessor, IFrameRenderer& frameRenderer) override
+    {
+        RenderComponentIndex* componentIndex = renderComponentAccessor->WriteWorldComponent<RenderComponentIndex>();
+        componentIndex->Prune(renderComponentAccessor);
+        componentIndex->Refresh(renderComponentAccessor);
+    }
+
+    void OnCreateEntity(Entity entity, const ComponentAccessor* componentAccessor,
+                        ComponentAccessor* renderComponentAccessor) override
+    {
+        RenderComponentIndex* componentIndex = renderComponentAccessor->WriteWorldComponent<RenderComponentIndex>();
+        componentIndex->AddEntity(entity, renderComponentAccessor);
+    }
+};
+
+RenderUpdaterRegisterer<ComponentIndexRenderUpdater> registerer((int)ERenderUpdaterOrder::PreRender);
+
+} // namespace
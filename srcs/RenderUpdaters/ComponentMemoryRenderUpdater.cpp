@@ -0,0 +1,80 @@
+#include "RenderUpdaterOrder.hpp"
+
+#include "hatcher/ComponentAccessor.hpp"
+#include "hatcher/Graphics/IEventListener.hpp"
+#include "hatcher/Graphics/RenderUpdater.hpp"
+
+#include "imgui.h"
+
+#include "utils/ComponentMemory.hpp"
+
+namespace
+{
+bool panelEnabled = false;
+
+class ComponentMemoryEventListener : public IEventListener
+{
+    void GetEvent(const SDL_Event& event, IApplication* application, ICommandManager* commandManager,
+                  const ComponentAccessor* componentAccessor, ComponentAccessor* renderComponentAccessor,
+                  const IFrameRenderer& frameRenderer) override
+    {
+        if (event.type == SDL_KEYDOWN && event.key.keysym.scancode == SDL_SCANCODE_F3)
+            panelEnabled = !panelEnabled;
+    }
+};
+
+void ComponentMemoryTable(const char* title, const std::vector<ComponentMemoryUsage>& usages)
+{
+    if (!ImGui::BeginTable(title, 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+        return;
+
+    ImGui::TableSetupColumn(title);
+    ImGui::TableSetupColumn("Count");
+    ImGui::TableSetupColumn("Dense (KiB)");
+    ImGui::TableSetupColumn("Sparse set (KiB)");
+    ImGui::TableSetupColumn("Recommended");
+    ImGui::TableHeadersRow();
+    for (const ComponentMemoryUsage& usage : usages)
+    {
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::Text("%s", usage.name);
+        ImGui::TableNextColumn();
+        ImGui::Text("%d / %d", usage.count, usage.slotCount);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.1f", usage.denseBytes / 1024.f);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.1f", usage.sparseSetBytes / 1024.f);
+        ImGui::TableNextColumn();
+        ImGui::Text("%s", usage.Recommendation() == EStorageRecommendation::Dense ? "Dense" : "Sparse set");
+    }
+    ImGui::EndTable();
+}
+
+// Counting components walks every slot of every type, so it only runs while the panel is shown.
+class ComponentMemoryRenderUpdater final : public RenderUpdater
+{
+public:
+    ComponentMemoryRenderUpdater(const IRendering* rendering) {}
+
+    void Update(IApplication* application, const ComponentAccessor* componentAccessor,
+                ComponentAccessor* renderComponentAccessor, IFrameRenderer& frameRenderer) override
+    {
+        if (!panelEnabled)
+            return;
+
+        ImGui::SetNextWindowSize({500, 400}, ImGuiCond_FirstUseEver);
+        if (ImGui::Begin("Component Memory", &panelEnabled))
+        {
+            ComponentMemoryTable("Gameplay", ComponentMemoryUsages(EComponentList::Gameplay, componentAccessor));
+            ComponentMemoryTable("Rendering",
+                                 ComponentMemoryUsages(EComponentList::Rendering, renderComponentAccessor));
+        }
+        ImGui::End();
+    }
+};
+
+EventListenerRegisterer<ComponentMemoryEventListener> eventRegisterer;
+RenderUpdaterRegisterer<ComponentMemoryRenderUpdater> updaterRegisterer((int)ERenderUpdaterOrder::Interface);
+
+} // namespace
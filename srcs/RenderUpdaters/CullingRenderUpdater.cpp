@@ -0,0 +1,188 @@
+#include "RenderUpdaterOrder.hpp"
+
+#include "hatcher/ComponentAccessor.hpp"
+#include "hatcher/Graphics/IFrameRenderer.hpp"
+#include "hatcher/Graphics/RenderUpdater.hpp"
+#include "hatcher/Maths/Box.hpp"
+#include "hatcher/Maths/glm_pure.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "Components/ItemComponent.hpp"
+#include "Components/MovementComponent.hpp"
+#include "Components/PositionComponent.hpp"
+#include "RenderComponents/SelectableComponent.hpp"
+#include "RenderComponents/SteveAnimationComponent.hpp"
+#include "RenderComponents/StaticMeshComponent.hpp"
+#include "WorldComponents/Camera.hpp"
+#include "WorldComponents/ComponentIndex.hpp"
+#include "WorldComponents/VisibleEntities.hpp"
+
+using namespace hatcher;
+
+namespace
+{
+
+// For drawn entities without selection box.
+const Box3f defaultBounds = Box3f({-1.f, -1.f, -0.25f}, {1.f, 1.f, 4.5f});
+// Heights any entity can reach, to know which ground the camera sees.
+constexpr float sceneMinHeight = -1.f;
+constexpr float sceneMaxHeight = 10.f;
+
+// Entities turn, so the box is widened to cover every orientation.
+Box3f WorldBounds(glm::vec2 position, const std::optional<SelectableComponent>& selectableComponent)
+{
+    const Box3f& box = selectableComponent ? selectableComponent->box : defaultBounds;
+    const float radius = std::max(glm::length(glm::vec2(box.Min())), glm::length(glm::vec2(box.Max())));
+    return Box3f(glm::vec3(position - glm::vec2(radius), box.Min().z),
+                 glm::vec3(position + glm::vec2(radius), box.Max().z));
+}
+
+class CullingRenderUpdater final : public RenderUpdater
+{
+public:
+    CullingRenderUpdater(const IRendering* rendering) {}
+
+    void Update(IApplication* application, const ComponentAccessor* componentAccessor,
+                ComponentAccessor* renderComponentAccessor, IFrameRenderer& frameRenderer) override
+    {
+        const Camera* camera = renderComponentAccessor->ReadWorldComponent<Camera>();
+        VisibleEntities* visibleEntities = renderComponentAccessor->WriteWorldComponent<VisibleEntities>();
+        const auto positionComponents = componentAccessor->ReadComponents<PositionComponent>();
+        const auto selectableComponents = renderComponentAccessor->ReadComponents<SelectableComponent>();
+
+        if (visibleEntities->StaticRebuildNeeded())
+            RebuildStaticGrid(componentAccessor, renderComponentAccessor, visibleEntities);
+        // Static entities only leave the grid when deleted, which also removes them from the render index.
+        const int renderIndexRevision = renderComponentAccessor->ReadWorldComponent<RenderComponentIndex>()->Revision();
+        if (renderIndexRevision != m_renderIndexRevision)
+        {
+            visibleEntities->InvalidateStaticEntries();
+            m_renderIndexRevision = renderIndexRevision;
+        }
+
+        const glm::mat4 projectionView = camera->ProjectionMatrix(frameRenderer.Resolution()) * camera->ViewMatrix();
+        visibleEntities->SetFrustum(projectionView);
+
+        m_visible.clear();
+        m_moved.clear();
+        const auto TestStatic = [&](const VisibleEntities::StaticEntry& entry)
+        {
+            const auto& positionComponent = positionComponents[entry.entity];
+            if (!positionComponent)
+                return VisibleEntities::EStaticVisit::Forget;
+            if (positionComponent->position != entry.position)
+            {
+                m_moved.push_back({entry.entity, positionComponent->position});
+                return VisibleEntities::EStaticVisit::Forget;
+            }
+            if (!visibleEntities->IsVisible(WorldBounds(entry.position, selectableComponents[entry.entity])))
+                return VisibleEntities::EStaticVisit::Culled;
+            m_visible.push_back(entry.entity);
+            return VisibleEntities::EStaticVisit::Visible;
+        };
+        const auto AddCell = [this](const VisibleEntities::StaticCell& cell)
+        {
+            for (const VisibleEntities::StaticEntry& entry : cell.entries)
+                m_visible.push_back(entry.entity);
+        };
+        const Box2f footprint = visibleEntities->Footprint(sceneMinHeight, sceneMaxHeight);
+        visibleEntities->VisitStaticEntities(footprint, TestStatic, AddCell);
+        for (const VisibleEntities::StaticEntry& entry : m_moved)
+        {
+            visibleEntities->AddStaticEntity(entry.entity, entry.position,
+                                             WorldBounds(entry.position, selectableComponents[entry.entity]));
+        }
+
+        // Moving entities stay out of the grid, they are few enough to be tested one by one.
+        m_visibleMoving.clear();
+        int movingCount = 0;
+        const auto TestMoving = [&](Entity entity)
+        {
+            const auto& positionComponent = positionComponents[entity];
+            if (!positionComponent)
+                return;
+            movingCount += 1;
+            if (visibleEntities->IsVisible(WorldBounds(positionComponent->position, selectableComponents[entity])))
+                m_visibleMoving.push_back(entity);
+        };
+        const auto* componentIndex = componentAccessor->ReadWorldComponent<GameplayComponentIndex>();
+        for (Entity entity : componentIndex->EntitiesWith<MovementComponent>())
+            TestMoving(entity);
+        for (Entity entity : componentIndex->EntitiesWith<ItemComponent>())
+            TestMoving(entity);
+        const auto ById = [](Entity a, Entity b) { return a.ID() < b.ID(); };
+        std::sort(m_visibleMoving.begin(), m_visibleMoving.end(), ById);
+
+        m_visible.insert(m_visible.end(), m_visibleMoving.begin(), m_visibleMoving.end());
+        std::sort(m_visible.begin(), m_visible.end(), ById);
+        m_visible.erase(std::unique(m_visible.begin(), m_visible.end()), m_visible.end());
+        const int culledCount =
+            visibleEntities->VisitedStaticCount() + movingCount - static_cast<int>(m_visible.size());
+        visibleEntities->SetEntities(m_visible, m_visibleMoving, culledCount);
+    }
+
+    void OnCreateEntity(Entity entity, const ComponentAccessor* componentAccessor,
+                        ComponentAccessor* renderComponentAccessor) override
+    {
+        const bool drawn = renderComponentAccessor->ReadComponents<StaticMeshComponent>()[entity] ||
+                           renderComponentAccessor->ReadComponents<SteveAnimationComponent>()[entity] ||
+                           renderComponentAccessor->ReadComponents<SelectableComponent>()[entity];
+        VisibleEntities* visibleEntities = renderComponentAccessor->WriteWorldComponent<VisibleEntities>();
+        // The entity may take the id of a deleted one, unseen by the render index.
+        visibleEntities->InvalidateStaticEntries();
+        if (drawn)
+            AddIfStatic(entity, componentAccessor, renderComponentAccessor, visibleEntities);
+    }
+
+private:
+    // Loaded entities are not created again: the grid is filled from every drawn entity instead.
+    void RebuildStaticGrid(const ComponentAccessor* componentAccessor, const ComponentAccessor* renderComponentAccessor,
+                           VisibleEntities* visibleEntities)
+    {
+        const auto* renderIndex = renderComponentAccessor->ReadWorldComponent<RenderComponentIndex>();
+        m_drawn.clear();
+        for (span<const Entity> entities :
+             {renderIndex->EntitiesWith<StaticMeshComponent>(), renderIndex->EntitiesWith<SteveAnimationComponent>(),
+              renderIndex->EntitiesWith<SelectableComponent>()})
+        {
+            m_drawn.insert(m_drawn.end(), entities.begin(), entities.end());
+        }
+        const auto ById = [](Entity a, Entity b) { return a.ID() < b.ID(); };
+        std::sort(m_drawn.begin(), m_drawn.end(), ById);
+        m_drawn.erase(std::unique(m_drawn.begin(), m_drawn.end()), m_drawn.end());
+
+        visibleEntities->ClearStaticEntities();
+        for (Entity entity : m_drawn)
+            AddIfStatic(entity, componentAccessor, renderComponentAccessor, visibleEntities);
+    }
+
+    static void AddIfStatic(Entity entity, const ComponentAccessor* componentAccessor,
+                            const ComponentAccessor* renderComponentAccessor, VisibleEntities* visibleEntities)
+    {
+        const auto& positionComponent = componentAccessor->ReadComponents<PositionComponent>()[entity];
+        if (!positionComponent || IsMoving(componentAccessor, entity))
+            return;
+        const auto& selectableComponent = renderComponentAccessor->ReadComponents<SelectableComponent>()[entity];
+        visibleEntities->AddStaticEntity(entity, positionComponent->position,
+                                         WorldBounds(positionComponent->position, selectableComponent));
+    }
+
+    // Items can be picked up, so they are tested every frame like walkers.
+    static bool IsMoving(const ComponentAccessor* componentAccessor, Entity entity)
+    {
+        return componentAccessor->ReadComponents<MovementComponent>()[entity] ||
+               componentAccessor->ReadComponents<ItemComponent>()[entity];
+    }
+
+    std::vector<Entity> m_visible;
+    std::vector<Entity> m_visibleMoving;
+    std::vector<VisibleEntities::StaticEntry> m_moved;
+    std::vector<Entity> m_drawn;
+    int m_renderIndexRevision = -1;
+};
+
+RenderUpdaterRegisterer<CullingRenderUpdater> registerer((int)ERenderUpdaterOrder::Culling);
+
+} // namespace
@@ -0,0 +1,28 @@
+#include "RenderUpdaterOrder.hpp"
+
+#include "hatcher/ComponentAccessor.hpp"
+#include "hatcher/Graphics/RenderUpdater.hpp"
+
+#include "WorldComponents/DrawList.hpp"
+
+using namespace hatcher;
+
+namespace
+{
+
+// Scene render updaters only add to the draw list: everything is drawn here, once they all ran.
+class DrawListRenderUpdater final : public RenderUpdater
+{
+public:
+    DrawListRenderUpdater(const IRendering* rendering) {}
+
+    void Update(IApplication* application, const ComponentAccessor* componentAccessor,
+                ComponentAccessor* renderComponentAccessor, IFrameRenderer& frameRenderer) override
+    {
+        renderComponentAccessor->WriteWorldComponent<DrawList>()->Submit(frameRenderer);
+    }
+};
+
+RenderUpdaterRegisterer<DrawListRenderUpdater> registerer((int)ERenderUpdaterOrder::SceneSubmit);
+
+} // namespace
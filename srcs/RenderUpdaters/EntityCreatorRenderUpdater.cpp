@@ -60,7 +60,7 @@ public:
         if (!inventoryStorage.empty())
         {
             auto& inventoryComponent = entityEgg.GetComponent<InventoryComponent>();
-            inventoryComponent->storage = inventoryStorage;
+            inventoryComponent->storage.assign(inventoryStorage.begin(), inventoryStorage.end());
         }
     }
 
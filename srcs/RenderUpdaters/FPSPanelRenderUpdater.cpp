@@ -1,11 +1,15 @@
 #include "RenderUpdaterOrder.hpp"
 
 #include "hatcher/Clock.hpp"
+#include "hatcher/ComponentAccessor.hpp"
 #include "hatcher/Graphics/IFrameRenderer.hpp"
 #include "hatcher/Graphics/RenderUpdater.hpp"
 
 #include "imgui.h"
 
+#include "WorldComponents/DrawList.hpp"
+#include "WorldComponents/VisibleEntities.hpp"
+
 #include <vector>
 
 using namespace hatcher;
@@ -33,6 +37,11 @@ public:
         {
             ImGui::Text("Frame time: %2.2f (%2.2f..%2.2f)\n", m_averageFrame, m_shortestFrame, m_longestFrame);
             ImGui::Text("FPS: %2.0f\n", m_fps);
+            const VisibleEntities* visibleEntities = renderComponentAccessor->ReadWorldComponent<VisibleEntities>();
+            ImGui::Text("Visible: %d, culled: %d\n", static_cast<int>(visibleEntities->Entities().size()),
+                        visibleEntities->CulledCount());
+            const DrawList* drawList = renderComponentAccessor->ReadWorldComponent<DrawList>();
+            ImGui::Text("Material binds: %d, draws: %d\n", drawList->MaterialBindCount(), drawList->DrawCount());
         }
         ImGui::End();
     }
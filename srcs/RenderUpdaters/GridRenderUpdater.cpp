@@ -13,6 +13,7 @@
 #include "hatcher/assert.hpp"
 #include "hatcher/unique_ptr.hpp"
 
+#include "WorldComponents/DrawList.hpp"
 #include "WorldComponents/SquareGrid.hpp"
 
 using namespace hatcher;
@@ -34,6 +35,7 @@ class GridEventListener : public IEventListener
     }
 };
 
+// The whole ground is one quad, its texture and grid lines being computed per fragment from world coordinates.
 class GridRenderUpdater : public RenderUpdater
 {
 public:
@@ -41,74 +43,46 @@ public:
     {
         MaterialFactory* materialFactory = rendering->GetMaterialFactory().get();
 
-        m_gridMaterial = materialFactory->CreateMaterial("shaders/grounded.vert", "shaders/const_color.frag");
-        m_gridMaterial->SetUniform("uniHeight", 0.01f);
-        m_gridMaterial->SetUniform("uniColor", glm::vec4(0.2, 0.2, 0.2, 1.0));
-        m_gridTileMesh = make_unique<Mesh>(m_gridMaterial.get(), Primitive::LineStrip);
-
         const Texture* texture = materialFactory->TextureFromFile("assets/textures/ground/grass.bmp");
 
-        m_tileMaterial = materialFactory->CreateMaterial("shaders/gridtile.vert", "shaders/textured.frag");
-        m_tileMaterial->AddTexture("uniTexture", texture);
-        m_walkableTileMesh = make_unique<Mesh>(m_tileMaterial.get(), Primitive::TriangleStrip);
-
-        FillGridMesh();
+        m_groundMaterial = materialFactory->CreateMaterial("shaders/gridtile.vert", "shaders/gridtile.frag");
+        m_groundMaterial->AddTexture("uniTexture", texture);
+        m_groundMesh = make_unique<Mesh>(m_groundMaterial.get(), Primitive::TriangleStrip);
     }
 
     void Update(IApplication* application, const ComponentAccessor* componentAccessor,
                 ComponentAccessor* renderComponentAccessor, IFrameRenderer& frameRenderer) override
     {
         const SquareGrid* grid = componentAccessor->ReadWorldComponent<SquareGrid>();
+        if (grid->GetTileCoordMin() != m_groundMin || grid->GetTileCoordMax() != m_groundMax)
+            FillGroundMesh(grid->GetTileCoordMin(), grid->GetTileCoordMax());
 
-        for (int y = grid->GetTileCoordMin().y; y < grid->GetTileCoordMax().y; y++)
-        {
-            for (int x = grid->GetTileCoordMin().x; x < grid->GetTileCoordMax().x; x++)
-            {
-                const glm::vec2 tileCenter = grid->GetTileCenter({x, y});
-                if (grid->HasTileData(tileCenter))
-                {
-                    const glm::mat4 tileMatrix = glm::translate(glm::vec3(tileCenter, 0.f));
-                    frameRenderer.PrepareSceneDraw(m_tileMaterial.get());
-                    m_walkableTileMesh->Draw(tileMatrix);
-                    if (gridDisplayEnabled)
-                    {
-                        frameRenderer.PrepareSceneDraw(m_gridMaterial.get());
-                        m_gridTileMesh->Draw(tileMatrix);
-                    }
-                }
-            }
-        }
+        m_groundMaterial->SetUniform("uniGridOpacity", gridDisplayEnabled ? 1.f : 0.f);
+        DrawList* drawList = renderComponentAccessor->WriteWorldComponent<DrawList>();
+        drawList->Add(m_groundMaterial.get(), m_groundMesh.get(), glm::mat4(1.f));
     }
 
 private:
-    void FillGridMesh()
+    void FillGroundMesh(glm::vec2 min, glm::vec2 max)
     {
-        const float tilePositions[] = {
-            -0.5f, -0.5f,
-
-            -0.5f, 0.5f,
-
-            0.5f,  -0.5f,
-
-            0.5f,  0.5f,
-        };
-        const float linePositions[] = {
-            -0.5f, -0.5f,
+        const float groundPositions[] = {
+            min.x, min.y,
 
-            -0.5f, 0.5f,
+            min.x, max.y,
 
-            0.5f,  0.5f,
+            max.x, min.y,
 
-            0.5f,  -0.5f,
+            max.x, max.y,
         };
-        m_walkableTileMesh->Set2DPositions(tilePositions, std::size(tilePositions));
-        m_gridTileMesh->Set2DPositions(linePositions, std::size(linePositions));
+        m_groundMesh->Set2DPositions(groundPositions, std::size(groundPositions));
+        m_groundMin = min;
+        m_groundMax = max;
     }
 
-    unique_ptr<Material> m_gridMaterial;
-    unique_ptr<Material> m_tileMaterial;
-    unique_ptr<Mesh> m_gridTileMesh;
-    unique_ptr<Mesh> m_walkableTileMesh;
+    unique_ptr<Material> m_groundMaterial;
+    unique_ptr<Mesh> m_groundMesh;
+    glm::vec2 m_groundMin = glm::vec2(0.f);
+    glm::vec2 m_groundMax = glm::vec2(0.f);
 };
 
 EventListenerRegisterer<GridEventListener> eventRegisterer;
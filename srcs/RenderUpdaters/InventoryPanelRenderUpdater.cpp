@@ -8,9 +8,9 @@
 #include "hatcher/assert.hpp"
 
 #include "Components/InventoryComponent.hpp"
-#include "Components/ItemComponent.hpp"
 #include "Components/NameComponent.hpp"
 #include "RenderComponents/SelectableComponent.hpp"
+#include "WorldComponents/ComponentIndex.hpp"
 
 #include "imgui.h"
 
@@ -43,30 +43,34 @@ public:
             return;
 
         const auto inventoryComponents = componentAccessor->ReadComponents<InventoryComponent>();
-        const auto itemComponents = componentAccessor->ReadComponents<ItemComponent>();
         const auto selectableComponents = renderComponentAccessor->ReadComponents<SelectableComponent>();
         const auto nameComponents = componentAccessor->ReadComponents<NameComponent>();
 
-        for (int i = 0; i < componentAccessor->Count(); i++)
+        const auto* componentIndex = componentAccessor->ReadWorldComponent<GameplayComponentIndex>();
+        for (Entity entity : componentIndex->EntitiesWith<InventoryComponent>())
         {
-            if (selectableComponents[i] && selectableComponents[i]->selected && inventoryComponents[i])
+            if (selectableComponents[entity] && selectableComponents[entity]->selected)
             {
-                HATCHER_ASSERT(nameComponents[i]);
-                const InventoryComponent& inventory = *inventoryComponents[i];
-                ImGui::PushID(i);
+                HATCHER_ASSERT(nameComponents[entity]);
+                const InventoryComponent& inventory = *inventoryComponents[entity];
+                ImGui::PushID(static_cast<int>(entity.ID()));
                 ImGui::SetNextWindowSize(ImVec2(200, 300), ImGuiCond_Once);
                 std::ostringstream windowNameOss;
-                windowNameOss << "Inventory - " << nameComponents[i]->name << "##" << i;
+                windowNameOss << "Inventory - " << nameComponents[entity]->name << "##" << entity.ID();
                 if (ImGui::Begin(windowNameOss.str().c_str(), &enabled))
                 {
                     ImGui::Text("Storage: %ld", inventory.storage.size());
                     for (Entity item : inventory.storage)
                     {
                         HATCHER_ASSERT(nameComponents[item]);
-                        char item_field[0x100];
-                        snprintf(item_field, std::size(item_field), "%s: %d", nameComponents[item]->name.c_str(),
-                                 itemComponents[item]->count);
-                        ImGui::Selectable(item_field);
+                        ImGui::Selectable(nameComponents[item]->name.c_str());
+                    }
+                    for (const ResourceStack& stack : inventory.resources)
+                    {
+                        char resource_field[0x100];
+                        snprintf(resource_field, std::size(resource_field), "%s: %d", ResourceName(stack.resource),
+                                 stack.count);
+                        ImGui::Selectable(resource_field);
                     }
                 }
                 ImGui::End();
@@ -2,6 +2,8 @@
 #include "Components/PositionComponent.hpp"
 #include "RenderComponents/SelectableComponent.hpp"
 #include "WorldComponents/Camera.hpp"
+#include "WorldComponents/ComponentIndex.hpp"
+#include "WorldComponents/PathPool.hpp"
 #include "WorldComponents/SquareGrid.hpp"
 
 #include "hatcher/CommandRegisterer.hpp"
@@ -19,15 +21,16 @@ using namespace hatcher;
 class MoveOrderCommand final : public ICommand
 {
 public:
-    MoveOrderCommand(Entity entity, const std::vector<glm::vec2>& path)
+    MoveOrderCommand(Entity entity, std::vector<glm::vec2>&& path)
         : m_entity(entity)
-        , m_path(path)
+        , m_path(std::move(path))
     {
     }
 
     void Execute(IEntityManager* entityManager, ComponentAccessor* componentAccessor) override
     {
-        componentAccessor->WriteComponents<MovementComponent>()[m_entity]->path = m_path;
+        MovementComponent& movement = *componentAccessor->WriteComponents<MovementComponent>()[m_entity];
+        componentAccessor->WriteWorldComponent<PathPool>()->SetPath(movement, m_path);
     }
 
 private:
@@ -54,23 +57,22 @@ public:
             if (!grid->GetTileData(worldCoords2D).walkable)
                 return;
 
-            auto movementComponents = componentAccessor->ReadComponents<MovementComponent>();
             auto selectableComponents = renderComponentAccessor->ReadComponents<SelectableComponent>();
             auto positionComponents = componentAccessor->ReadComponents<PositionComponent>();
 
             HATCHER_ASSERT(componentAccessor->Count() == renderComponentAccessor->Count());
-            for (int i = 0; i < componentAccessor->Count(); i++)
+            const auto* componentIndex = componentAccessor->ReadWorldComponent<GameplayComponentIndex>();
+            for (Entity entity : componentIndex->EntitiesWith<MovementComponent>())
             {
-                const std::optional<MovementComponent>& movementComponent = movementComponents[i];
-                const std::optional<SelectableComponent>& selectableComponent = selectableComponents[i];
-                const std::optional<PositionComponent>& positionComponent = positionComponents[i];
-                if (selectableComponent && selectableComponent->selected && movementComponent)
+                const std::optional<SelectableComponent>& selectableComponent = selectableComponents[entity];
+                const std::optional<PositionComponent>& positionComponent = positionComponents[entity];
+                if (selectableComponent && selectableComponent->selected)
                 {
                     HATCHER_ASSERT(positionComponent);
                     std::vector<glm::vec2> path = grid->GetPathIfPossible(positionComponent->position, worldCoords2D);
                     if (!path.empty())
                     {
-                        commandManager->AddCommand(new MoveOrderCommand(Entity(i), path));
+                        commandManager->AddCommand(new MoveOrderCommand(entity, std::move(path)));
                     }
                 }
             }
@@ -4,6 +4,9 @@ enum class ERenderUpdaterOrder
 {
     PreRender,
     Camera,
+    Culling,
+    Transform,
     Scene,
+    SceneSubmit,
     Interface,
 };
@@ -13,7 +13,8 @@
 #include "Components/ObstacleComponent.hpp"
 #include "Components/PositionComponent.hpp"
 #include "RenderComponents/SelectableComponent.hpp"
-#include "utils/TransformationHelper.hpp"
+#include "RenderComponents/TransformComponent.hpp"
+#include "WorldComponents/VisibleEntities.hpp"
 
 using namespace hatcher;
 
@@ -64,16 +65,19 @@ public:
         auto selectableComponents = renderComponentAccessor->ReadComponents<SelectableComponent>();
         auto positionComponents = componentAccessor->ReadComponents<PositionComponent>();
         auto obstacleComponents = componentAccessor->ReadComponents<ObstacleComponent>();
-        for (int i = 0; i < componentAccessor->Count(); i++)
+        auto transformComponents = renderComponentAccessor->ReadComponents<TransformComponent>();
+        const VisibleEntities* visibleEntities = renderComponentAccessor->ReadWorldComponent<VisibleEntities>();
+        for (Entity entity : visibleEntities->Entities())
         {
-            const std::optional<SelectableComponent>& selectableComponent = selectableComponents[i];
-            const std::optional<PositionComponent>& positionComponent = positionComponents[i];
-            if (positionComponent && selectableComponent && selectableComponent->selected)
+            const std::optional<SelectableComponent>& selectableComponent = selectableComponents[entity];
+            const std::optional<PositionComponent>& positionComponent = positionComponents[entity];
+            const std::optional<TransformComponent>& transformComponent = transformComponents[entity];
+            if (positionComponent && transformComponent && selectableComponent && selectableComponent->selected)
             {
-                glm::mat4 modelMatrix = TransformationHelper::ModelFromComponents(*positionComponent);
-                if (obstacleComponents[i])
+                glm::mat4 modelMatrix = transformComponent->model;
+                if (obstacleComponents[entity])
                 {
-                    const glm::ivec2 boxExtent = obstacleComponents[i]->area.Extents();
+                    const glm::ivec2 boxExtent = obstacleComponents[entity]->traits->area.Extents();
                     const glm::vec2 scaleXY = static_cast<glm::vec2>(boxExtent) + glm::vec2(1.f, 1.f);
                     const glm::vec3 scale = glm::vec3(scaleXY, 1.f) * 1.1f;
                     modelMatrix = glm::scale(modelMatrix, scale);
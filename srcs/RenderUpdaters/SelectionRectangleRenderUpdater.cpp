@@ -3,7 +3,8 @@
 #include "Components/MovementComponent.hpp"
 #include "Components/PositionComponent.hpp"
 #include "RenderComponents/SelectableComponent.hpp"
-#include "utils/TransformationHelper.hpp"
+#include "RenderComponents/TransformComponent.hpp"
+#include "WorldComponents/VisibleEntities.hpp"
 
 #include "hatcher/ComponentAccessor.hpp"
 #include "hatcher/Graphics/FrameRenderer.hpp"
@@ -75,19 +76,27 @@ class SelectionRectangleEventListener : public IEventListener
                 renderComponentAccessor->WriteComponents<SelectableComponent>();
             ComponentReader<PositionComponent> positionComponents =
                 componentAccessor->ReadComponents<PositionComponent>();
+            ComponentReader<TransformComponent> transformComponents =
+                renderComponentAccessor->ReadComponents<TransformComponent>();
             const Box2f selectionBox = selectionRectangle.GetCurrentSelection();
 
             HATCHER_ASSERT(componentAccessor->Count() == renderComponentAccessor->Count());
             for (int i = 0; i < componentAccessor->Count(); i++)
             {
-                std::optional<SelectableComponent>& selectableComponent = selectableComponents[i];
-                const std::optional<PositionComponent>& positionComponent = positionComponents[i];
-                if (selectableComponent && positionComponent)
-                {
-                    const glm::mat4 modelMatrix = TransformationHelper::ModelFromComponents(*positionComponent);
+                if (selectableComponents[i])
+                    selectableComponents[i]->selected = false;
+            }
 
+            // Only what is on screen can touch the rectangle, and only its transforms are up to date.
+            const VisibleEntities* visibleEntities = renderComponentAccessor->ReadWorldComponent<VisibleEntities>();
+            for (Entity entity : visibleEntities->Entities())
+            {
+                std::optional<SelectableComponent>& selectableComponent = selectableComponents[entity];
+                const std::optional<TransformComponent>& transformComponent = transformComponents[entity];
+                if (selectableComponent && positionComponents[entity] && transformComponent)
+                {
                     const Box2f entitySelectionBox =
-                        frameRenderer.ProjectBox3DToWindowCoords(selectableComponent->box, modelMatrix);
+                        frameRenderer.ProjectBox3DToWindowCoords(selectableComponent->box, transformComponent->model);
                     selectableComponent->selected = selectionBox.Touches(entitySelectionBox);
                 }
             }
@@ -11,8 +11,12 @@
 #include "hatcher/Graphics/Texture.hpp"
 #include "hatcher/Maths/glm_pure.hpp"
 
-#include <utility> // std::pair
+#include <algorithm>
+#include <optional>
+#include <unordered_map>
+#include <vector>
 
+#include "Components/BusinessComponent.hpp"
 #include "Components/GrowableComponent.hpp"
 #include "Components/InventoryComponent.hpp"
 #include "Components/ItemComponent.hpp"
@@ -20,6 +24,12 @@
 #include "RenderComponents/ItemDisplayComponent.hpp"
 #include "RenderComponents/SelectableComponent.hpp"
 #include "RenderComponents/StaticMeshComponent.hpp"
+#include "RenderComponents/TransformComponent.hpp"
+#include "WorldComponents/ComponentIndex.hpp"
+#include "WorldComponents/DrawList.hpp"
+#include "WorldComponents/GroundStacks.hpp"
+#include "WorldComponents/VisibleEntities.hpp"
+#include "WorldComponents/WorldClock.hpp"
 #include "utils/TransformationHelper.hpp"
 
 using namespace hatcher;
@@ -35,19 +45,55 @@ unique_ptr<Material> CreateTextureMaterial(MaterialFactory* materialFactory, con
     return material;
 }
 
-int ItemIndex(const InventoryComponent& inventory, Entity entity, ComponentReader<ItemComponent> itemComponents)
+StaticMeshComponent::Type ResourceMesh(EResource resource)
 {
-    const ItemComponent::EType itemType = itemComponents[entity]->type;
-    int typeIndex = 0;
-    int index = 0;
-    while (inventory.storage[index] != entity)
+    switch (resource)
     {
-        Entity entity = inventory.storage[index];
-        if (itemComponents[entity]->type == itemType)
-            typeIndex++;
-        index++;
+    case EResource::Wood:
+        return StaticMeshComponent::Wood;
+    default:
+        HATCHER_ASSERT(false);
+        return StaticMeshComponent::Wood;
+    }
+}
+
+// Around a stack of up to 3 layers.
+Box3f StackBounds(glm::vec2 position)
+{
+    return Box3f(glm::vec3(position - glm::vec2(0.5f), 0.f), glm::vec3(position + glm::vec2(0.5f), 1.5f));
+}
+
+// Up to 12 pieces, 4 per layer, each its own matrix.
+void AddStackMatrices(std::vector<glm::mat4>& matrices, glm::mat4 modelMatrix, int count)
+{
+    HATCHER_ASSERT(count >= 1);
+    count = std::min(count, 12);
+    while (count > 0)
+    {
+        switch (count)
+        {
+        case 1:
+            matrices.push_back(modelMatrix);
+            break;
+        case 2:
+            matrices.push_back(glm::translate(modelMatrix, glm::vec3(0.25f, 0.f, 0.f)));
+            matrices.push_back(glm::translate(modelMatrix, glm::vec3(-0.25f, 0.f, 0.f)));
+            break;
+        case 3:
+            matrices.push_back(glm::translate(modelMatrix, glm::vec3(0.25f, 0.25f, 0.f)));
+            matrices.push_back(glm::translate(modelMatrix, glm::vec3(-0.25f, 0.25f, 0.f)));
+            matrices.push_back(glm::translate(modelMatrix, glm::vec3(0.f, -0.25f, 0.f)));
+            break;
+        default:
+            matrices.push_back(glm::translate(modelMatrix, glm::vec3(0.25f, 0.25f, 0.f)));
+            matrices.push_back(glm::translate(modelMatrix, glm::vec3(0.25f, -0.25f, 0.f)));
+            matrices.push_back(glm::translate(modelMatrix, glm::vec3(-0.25f, 0.25f, 0.f)));
+            matrices.push_back(glm::translate(modelMatrix, glm::vec3(-0.25f, -0.25f, 0.f)));
+            break;
+        }
+        count -= 4;
+        modelMatrix = glm::translate(modelMatrix, glm::vec3(0.f, 0.f, 0.5f));
     }
-    return typeIndex;
 }
 
 class StaticMeshRenderUpdater final : public RenderUpdater
@@ -74,83 +120,123 @@ public:
     {
         const auto positionComponents = componentAccessor->ReadComponents<PositionComponent>();
         const auto growableComponents = componentAccessor->ReadComponents<GrowableComponent>();
+        const int currentTick = componentAccessor->ReadWorldComponent<WorldClock>()->tick;
         const auto inventoryComponents = componentAccessor->ReadComponents<InventoryComponent>();
         const auto itemComponents = componentAccessor->ReadComponents<ItemComponent>();
         const auto itemDisplaysComponents = renderComponentAccessor->ReadComponents<ItemDisplayComponent>();
         auto staticMeshComponents = renderComponentAccessor->WriteComponents<StaticMeshComponent>();
+        const auto transformComponents = renderComponentAccessor->ReadComponents<TransformComponent>();
+
+        // Gathered by mesh, so that each batch of matrices is added to the draw list at once.
+        for (std::vector<glm::mat4>& matrices : m_matrices)
+            matrices.clear();
+
+        const VisibleEntities* visibleEntities = renderComponentAccessor->ReadWorldComponent<VisibleEntities>();
+        for (Entity entity : visibleEntities->MovingEntities())
+        {
+            if (staticMeshComponents[entity] && positionComponents[entity] && transformComponents[entity])
+            {
+                const hatcher::uint type = staticMeshComponents[entity]->type;
+                HATCHER_ASSERT(type < StaticMeshComponent::COUNT);
+                m_matrices[type].push_back(transformComponents[entity]->model);
+            }
+        }
+
+        // Immobile entities are drawn from their cell's batch, only rebuilt when the cell or a growth changed.
+        m_visibleBatches.clear();
+        for (int64_t cellKey : visibleEntities->VisibleCells())
+        {
+            const VisibleEntities::StaticCell& cell = visibleEntities->Cell(cellKey);
+            StaticBatch& batch = m_staticBatches[cellKey];
+            if (batch.revision != cell.revision || HasMatured(batch, growableComponents, currentTick))
+                RebuildBatch(batch, cell, componentAccessor, staticMeshComponents, transformComponents);
 
-        for (int i = 0; i < componentAccessor->Count(); i++)
+            for (Entity entity : batch.growing)
+            {
+                const float maturity = GetMaturity(*growableComponents[entity], currentTick);
+                const glm::mat4 modelMatrix = glm::scale(transformComponents[entity]->model, glm::vec3(maturity));
+                m_matrices[staticMeshComponents[entity]->type].push_back(modelMatrix);
+            }
+            m_visibleBatches.push_back(&batch);
+        }
+        if (m_sweptStaticRevision != visibleEntities->StaticRevision())
         {
-            if (staticMeshComponents[i])
+            EvictStaleBatches(*visibleEntities);
+            m_sweptStaticRevision = visibleEntities->StaticRevision();
+        }
+
+        // Walking the storage in order numbers the slots of each type, without searching for any item.
+        for (Entity entity : visibleEntities->Entities())
+        {
+            const auto inventoryComponent = inventoryComponents[entity];
+            const auto transformComponent = transformComponents[entity];
+            if (!itemDisplaysComponents[entity] || !inventoryComponent || !positionComponents[entity] ||
+                !transformComponent)
+            {
+                continue;
+            }
+            const ItemDisplayComponent& itemDisplay = *itemDisplaysComponents[entity];
+            const glm::mat4& holderMatrix = transformComponent->model;
+
+            int typeSlots[ItemComponent::COUNT] = {};
+            for (Entity item : inventoryComponent->storage)
+            {
+                const ItemComponent::EType itemType = itemComponents[item]->type;
+                const std::optional<glm::mat4>& location = itemDisplay.Location(itemType, typeSlots[itemType]++);
+                const auto staticMeshComponent = staticMeshComponents[item];
+                if (!location || !staticMeshComponent)
+                    continue;
+                m_matrices[staticMeshComponent->type].push_back(holderMatrix * *location);
+            }
+
+            for (int index = 0; index < static_cast<int>(inventoryComponent->resources.size()); index++)
             {
-                HATCHER_ASSERT(staticMeshComponents[i]->type < StaticMeshComponent::COUNT);
-                const unique_ptr<Mesh>& mesh = m_meshes[staticMeshComponents[i]->type];
-                const unique_ptr<Material>& material = m_materials[staticMeshComponents[i]->type];
-
-                const auto positionComponent = positionComponents[i];
-                const auto itemComponent = itemComponents[i];
-
-                std::optional<glm::mat4> modelMatrix;
-                if (positionComponent)
-                {
-                    modelMatrix = TransformationHelper::ModelFromComponents(*positionComponent);
-                    if (growableComponents[i])
-                    {
-                        modelMatrix = glm::scale(*modelMatrix, glm::vec3(growableComponents[i]->maturity));
-                    }
-                }
-                else if (itemComponent && itemComponent->inventory)
-                {
-                    const Entity inventory = *itemComponent->inventory;
-                    const auto storagePosition = positionComponents[inventory];
-                    if (storagePosition && itemDisplaysComponents[inventory])
-                    {
-                        const auto itemDisplayComponent = itemDisplaysComponents[inventory];
-                        const auto inventoryComponent = *inventoryComponents[inventory];
-                        const int itemIndex = ItemIndex(inventoryComponent, Entity(i), itemComponents);
-                        const ItemDisplayComponent::LocationKey locationKey(itemComponent->type, itemIndex);
-                        const auto it = itemDisplayComponent->locations.find(locationKey);
-                        if (it != itemDisplayComponent->locations.end())
-                        {
-                            modelMatrix = TransformationHelper::ModelFromComponents(*storagePosition);
-                            modelMatrix = *modelMatrix * it->second;
-                        }
-                    }
-                }
-                if (modelMatrix)
-                {
-                    frameRenderer.PrepareSceneDraw(material.get());
-                    int count = itemComponent ? std::min(itemComponent->count, 12) : 1;
-                    HATCHER_ASSERT(count >= 1);
-                    while (count > 0)
-                    {
-                        switch (count)
-                        {
-                        case 1:
-                            mesh->Draw(*modelMatrix);
-                            break;
-                        case 2:
-                            mesh->Draw(glm::translate(*modelMatrix, glm::vec3(0.25f, 0.f, 0.f)));
-                            mesh->Draw(glm::translate(*modelMatrix, glm::vec3(-0.25f, 0.f, 0.f)));
-                            break;
-                        case 3:
-                            mesh->Draw(glm::translate(*modelMatrix, glm::vec3(0.25f, 0.25f, 0.f)));
-                            mesh->Draw(glm::translate(*modelMatrix, glm::vec3(-0.25f, 0.25f, 0.f)));
-                            mesh->Draw(glm::translate(*modelMatrix, glm::vec3(0.f, -0.25f, 0.f)));
-                            break;
-                        default:
-                            mesh->Draw(glm::translate(*modelMatrix, glm::vec3(0.25f, 0.25f, 0.f)));
-                            mesh->Draw(glm::translate(*modelMatrix, glm::vec3(0.25f, -0.25f, 0.f)));
-                            mesh->Draw(glm::translate(*modelMatrix, glm::vec3(-0.25f, 0.25f, 0.f)));
-                            mesh->Draw(glm::translate(*modelMatrix, glm::vec3(-0.25f, -0.25f, 0.f)));
-                            break;
-                        }
-                        count -= 4;
-                        modelMatrix = glm::translate(*modelMatrix, glm::vec3(0.f, 0.f, 0.5f));
-                    }
-                }
+                const ResourceStack& stack = inventoryComponent->resources[index];
+                const std::optional<glm::mat4>& location = itemDisplay.Location(ItemComponent::Resource, index);
+                if (!location)
+                    continue;
+                AddStackMatrices(m_matrices[ResourceMesh(stack.resource)], holderMatrix * *location, stack.count);
             }
         }
+
+        for (const GroundStacks::Stack& stack : componentAccessor->ReadWorldComponent<GroundStacks>()->Stacks())
+        {
+            if (!visibleEntities->IsVisible(StackBounds(stack.position)))
+                continue;
+            const PositionComponent stackPosition = {
+                .position = stack.position,
+                .orientation = {1.f, 0.f},
+            };
+            AddStackMatrices(m_matrices[ResourceMesh(stack.resource)],
+                             TransformationHelper::ModelFromComponents(stackPosition), stack.count);
+        }
+
+        const auto businessComponents = componentAccessor->ReadComponents<BusinessComponent>();
+        const auto* componentIndex = componentAccessor->ReadWorldComponent<GameplayComponentIndex>();
+        for (Entity entity : componentIndex->EntitiesWith<BusinessComponent>())
+        {
+            const BusinessComponent::Stockpile& stockpile = businessComponents[entity]->stockpile;
+            if (!visibleEntities->IsVisible(StackBounds(stockpile.position)))
+                continue;
+            for (const ResourceStack& stack : stockpile.resources)
+            {
+                const PositionComponent stackPosition = {
+                    .position = stockpile.position,
+                    .orientation = {1.f, 0.f},
+                };
+                AddStackMatrices(m_matrices[ResourceMesh(stack.resource)],
+                                 TransformationHelper::ModelFromComponents(stackPosition), stack.count);
+            }
+        }
+
+        // Neither list changes before the draw list is submitted, so their matrices are not copied.
+        DrawList* drawList = renderComponentAccessor->WriteWorldComponent<DrawList>();
+        for (hatcher::uint type = 0; type < StaticMeshComponent::COUNT; type++)
+        {
+            drawList->AddBatch(m_materials[type].get(), m_meshes[type].get(), m_matrices[type]);
+            for (const StaticBatch* batch : m_visibleBatches)
+                drawList->AddBatch(m_materials[type].get(), m_meshes[type].get(), batch->matrices[type]);
+        }
     }
 
     void OnCreateEntity(Entity entity, const ComponentAccessor* componentAccessor,
@@ -166,6 +252,62 @@ public:
     }
 
 private:
+    struct StaticBatch
+    {
+        int revision = -1;
+        std::vector<glm::mat4> matrices[StaticMeshComponent::COUNT];
+        // Still growing, so scaled at each frame until they mature.
+        std::vector<Entity> growing;
+    };
+
+    static bool HasMatured(const StaticBatch& batch, const ComponentReader<GrowableComponent>& growableComponents,
+                           int currentTick)
+    {
+        const auto Matured = [&](Entity entity)
+        { return !growableComponents[entity] || GetMaturity(*growableComponents[entity], currentTick) >= 1.f; };
+        return std::any_of(batch.growing.begin(), batch.growing.end(), Matured);
+    }
+
+    static void RebuildBatch(StaticBatch& batch, const VisibleEntities::StaticCell& cell,
+                             const ComponentAccessor* componentAccessor,
+                             const ComponentWriter<StaticMeshComponent>& staticMeshComponents,
+                             const ComponentReader<TransformComponent>& transformComponents)
+    {
+        const auto positionComponents = componentAccessor->ReadComponents<PositionComponent>();
+        const auto growableComponents = componentAccessor->ReadComponents<GrowableComponent>();
+        const int currentTick = componentAccessor->ReadWorldComponent<WorldClock>()->tick;
+
+        for (std::vector<glm::mat4>& matrices : batch.matrices)
+            matrices.clear();
+        batch.growing.clear();
+        for (const VisibleEntities::StaticEntry& entry : cell.entries)
+        {
+            const auto& staticMeshComponent = staticMeshComponents[entry.entity];
+            const auto& transformComponent = transformComponents[entry.entity];
+            if (!staticMeshComponent || !positionComponents[entry.entity] || !transformComponent)
+                continue;
+            const auto& growableComponent = growableComponents[entry.entity];
+            if (growableComponent && GetMaturity(*growableComponent, currentTick) < 1.f)
+                batch.growing.push_back(entry.entity);
+            else
+                batch.matrices[staticMeshComponent->type].push_back(transformComponent->model);
+        }
+        batch.revision = cell.revision;
+    }
+
+    // Batches of emptied or changed cells out of view would only be rebuilt when seen again.
+    void EvictStaleBatches(const VisibleEntities& visibleEntities)
+    {
+        for (auto it = m_staticBatches.begin(); it != m_staticBatches.end();)
+        {
+            const VisibleEntities::StaticCell& cell = visibleEntities.Cell(it->first);
+            if (cell.entries.empty() || cell.revision != it->second.revision)
+                it = m_staticBatches.erase(it);
+            else
+                ++it;
+        }
+    }
+
     void CreateTexturedMesh(MeshLoader* meshLoader, MaterialFactory* materialFactory, StaticMeshComponent::Type type,
                             const char* meshFileName, const char* textureFileName)
     {
@@ -182,6 +324,11 @@ private:
 
     unique_ptr<Material> m_materials[StaticMeshComponent::COUNT];
     unique_ptr<Mesh> m_meshes[StaticMeshComponent::COUNT];
+    // This frame's model matrices, by mesh. Kept between frames to reuse their capacity.
+    std::vector<glm::mat4> m_matrices[StaticMeshComponent::COUNT];
+    std::unordered_map<int64_t, StaticBatch> m_staticBatches;
+    int m_sweptStaticRevision = -1;
+    std::vector<const StaticBatch*> m_visibleBatches;
 };
 
 RenderUpdaterRegisterer<StaticMeshRenderUpdater> registerer((int)ERenderUpdaterOrder::Scene);
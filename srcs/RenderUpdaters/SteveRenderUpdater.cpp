@@ -20,7 +20,11 @@
 #include "RenderComponents/ItemDisplayComponent.hpp"
 #include "RenderComponents/SelectableComponent.hpp"
 #include "RenderComponents/SteveAnimationComponent.hpp"
-#include "utils/TransformationHelper.hpp"
+#include "RenderComponents/TransformComponent.hpp"
+#include "WorldComponents/ComponentIndex.hpp"
+#include "WorldComponents/DrawList.hpp"
+#include "WorldComponents/VisibleEntities.hpp"
+#include "utils/ParallelFor.hpp"
 
 using namespace hatcher;
 
@@ -38,45 +42,44 @@ public:
         const auto positionComponents = componentAccessor->ReadComponents<PositionComponent>();
         const auto movementComponents = componentAccessor->ReadComponents<MovementComponent>();
         const auto inventoryComponents = componentAccessor->ReadComponents<InventoryComponent>();
-        const auto itemComponents = componentAccessor->ReadComponents<ItemComponent>();
         const auto workerComponents = componentAccessor->ReadComponents<WorkerComponent>();
         auto itemDisplayComponents = renderComponentAccessor->WriteComponents<ItemDisplayComponent>();
         auto animationComponents = renderComponentAccessor->WriteComponents<SteveAnimationComponent>();
         const float gameSpeed = application->GetUpdateTickrate() / 60.f;
 
-        for (int i = 0; i < componentAccessor->Count(); i++)
+        const auto* renderComponentIndex = renderComponentAccessor->ReadWorldComponent<RenderComponentIndex>();
+        const span<const Entity> steves = renderComponentIndex->EntitiesWith<SteveAnimationComponent>();
+        const auto AnimateSteve = [&](int steveIndex)
         {
-            if (positionComponents[i] && movementComponents[i] && animationComponents[i])
+            const Entity steve = steves[steveIndex];
+            if (positionComponents[steve] && movementComponents[steve] && animationComponents[steve])
             {
-                SteveAnimationComponent& animation = *animationComponents[i];
-                const bool moving = !movementComponents[i]->path.empty();
-                const bool working = workerComponents[i] && workerComponents[i]->workIndex;
+                SteveAnimationComponent& animation = *animationComponents[steve];
+                const bool moving = movementComponents[steve]->remainingWaypoints > 0;
+                const bool working = workerComponents[steve] && workerComponents[steve]->workIndex;
                 UpdateAnimationComponent(animation, gameSpeed, moving, working);
 
-                const auto IsResource = [&itemComponents](Entity entity)
-                { return itemComponents[entity]->type == ItemComponent::Resource; };
-                if (inventoryComponents[i] &&
-                    std::find_if(inventoryComponents[i]->storage.begin(), inventoryComponents[i]->storage.end(),
-                                 IsResource) != inventoryComponents[i]->storage.end())
+                if (inventoryComponents[steve] && !inventoryComponents[steve]->resources.empty())
                 {
                     animation.rightArmAngle = M_PI;
                     animation.leftArmAngle = M_PI;
                 }
 
-                HATCHER_ASSERT(itemDisplayComponents[i]);
-                ItemDisplayComponent& itemDisplayComponent = *itemDisplayComponents[i];
+                HATCHER_ASSERT(itemDisplayComponents[steve]);
+                ItemDisplayComponent& itemDisplayComponent = *itemDisplayComponents[steve];
                 glm::mat4 toolLocation(1.f);
                 toolLocation = glm::translate(toolLocation, glm::vec3(0.0f, -0.3f, 1.1f));
                 toolLocation = glm::rotate(toolLocation, -animation.rightArmAngle + static_cast<float>(M_PI) / 2.f,
                                            glm::vec3(0.f, 1.f, 0.0f));
                 toolLocation = glm::translate(toolLocation, glm::vec3(0.4f, 0.0f, -0.2f));
-                itemDisplayComponent.locations[std::make_pair(ItemComponent::Tool, 0)] = toolLocation;
+                itemDisplayComponent.SetLocation(ItemComponent::Tool, 0, toolLocation);
 
                 glm::mat4 resourceLocation(1.f);
                 resourceLocation = glm::translate(resourceLocation, glm::vec3(0.f, 0.f, 1.8f));
-                itemDisplayComponent.locations[std::make_pair(ItemComponent::Resource, 0)] = resourceLocation;
+                itemDisplayComponent.SetLocation(ItemComponent::Resource, 0, resourceLocation);
             }
-        }
+        };
+        ParallelFor(static_cast<int>(steves.size()), AnimateSteve);
     }
 
 private:
@@ -124,7 +127,7 @@ class SteveRenderUpdater final : public RenderUpdater
 {
 public:
     SteveRenderUpdater(const IRendering* rendering)
-        : m_bodyParts({&m_torso, &m_head, &m_leftArm, &m_rightArm, &m_leftLeg, &m_rightLeg})
+        : m_bodyParts({&m_body, &m_leftArm, &m_rightArm, &m_leftLeg, &m_rightLeg})
     {
         m_material = rendering->GetMaterialFactory()->CreateMaterial("shaders/textured.vert", "shaders/textured.frag");
 
@@ -133,15 +136,14 @@ public:
 
         const Material* material = m_material.get();
         MeshLoader* meshLoader = rendering->GetMeshLoader().get();
-        m_torso.mesh = meshLoader->LoadWavefront(material, "assets/meshes/steve/torso.obj");
-        m_head.mesh = meshLoader->LoadWavefront(material, "assets/meshes/steve/head.obj");
+        // Torso and head in one mesh, as they never move relative to each other.
+        m_body.mesh = meshLoader->LoadWavefront(material, "assets/meshes/steve/body.obj");
         m_leftArm.mesh = meshLoader->LoadWavefront(material, "assets/meshes/steve/left_arm.obj");
         m_rightArm.mesh = meshLoader->LoadWavefront(material, "assets/meshes/steve/right_arm.obj");
         m_leftLeg.mesh = meshLoader->LoadWavefront(material, "assets/meshes/steve/left_leg.obj");
         m_rightLeg.mesh = meshLoader->LoadWavefront(material, "assets/meshes/steve/right_leg.obj");
 
-        m_torso.matrix = glm::mat4(1.f);
-        m_head.matrix = glm::translate(glm::mat4(1.f), glm::vec3(0.f, 0.f, 1.2f));
+        m_body.matrix = glm::mat4(1.f);
         m_leftArm.matrix = glm::translate(glm::mat4(1.f), glm::vec3(0.0f, 0.3f, 1.1f));
         m_rightArm.matrix = glm::translate(glm::mat4(1.f), glm::vec3(0.0f, -0.3f, 1.1f));
         m_leftLeg.matrix = glm::translate(glm::mat4(1.f), glm::vec3(0.0f, 0.1f, 0.6f));
@@ -153,17 +155,18 @@ public:
     void Update(IApplication* application, const ComponentAccessor* componentAccessor,
                 ComponentAccessor* renderComponentAccessor, IFrameRenderer& frameRenderer) override
     {
-        frameRenderer.PrepareSceneDraw(m_material.get());
-
+        DrawList* drawList = renderComponentAccessor->WriteWorldComponent<DrawList>();
         const auto positionComponents = componentAccessor->ReadComponents<PositionComponent>();
         auto animationComponents = renderComponentAccessor->WriteComponents<SteveAnimationComponent>();
+        const auto transformComponents = renderComponentAccessor->ReadComponents<TransformComponent>();
 
-        for (int i = 0; i < componentAccessor->Count(); i++)
+        const VisibleEntities* visibleEntities = renderComponentAccessor->ReadWorldComponent<VisibleEntities>();
+        for (Entity steve : visibleEntities->Entities())
         {
-            if (positionComponents[i] && animationComponents[i])
+            if (positionComponents[steve] && animationComponents[steve] && transformComponents[steve])
             {
-                const glm::mat4 modelMatrix = TransformationHelper::ModelFromComponents(*positionComponents[i]);
-                SteveAnimationComponent& animation = *animationComponents[i];
+                const glm::mat4& modelMatrix = transformComponents[steve]->model;
+                SteveAnimationComponent& animation = *animationComponents[steve];
                 const glm::mat4 rightLegMatrix =
                     glm::rotate(m_rightLeg.matrix, animation.rightLegAngle, glm::vec3(0.f, 1.f, 0.f));
                 const glm::mat4 leftLegMatrix =
@@ -173,12 +176,11 @@ public:
                 const glm::mat4 rightArmMatrix =
                     glm::rotate(m_rightArm.matrix, rightArmAngle, glm::vec3(0.f, -1.f, 0.f));
                 const glm::mat4 leftArmMatrix = glm::rotate(m_leftArm.matrix, leftArmAngle, glm::vec3(0.f, 1.f, 0.f));
-                m_torso.mesh->Draw(modelMatrix * m_torso.matrix);
-                m_head.mesh->Draw(modelMatrix * m_head.matrix);
-                m_rightArm.mesh->Draw(modelMatrix * rightArmMatrix);
-                m_leftArm.mesh->Draw(modelMatrix * leftArmMatrix);
-                m_rightLeg.mesh->Draw(modelMatrix * rightLegMatrix);
-                m_leftLeg.mesh->Draw(modelMatrix * leftLegMatrix);
+                drawList->Add(m_material.get(), m_body.mesh.get(), modelMatrix * m_body.matrix);
+                drawList->Add(m_material.get(), m_rightArm.mesh.get(), modelMatrix * rightArmMatrix);
+                drawList->Add(m_material.get(), m_leftArm.mesh.get(), modelMatrix * leftArmMatrix);
+                drawList->Add(m_material.get(), m_rightLeg.mesh.get(), modelMatrix * rightLegMatrix);
+                drawList->Add(m_material.get(), m_leftLeg.mesh.get(), modelMatrix * leftLegMatrix);
             }
         }
     }
@@ -206,13 +208,12 @@ public:
     };
 
     unique_ptr<Material> m_material;
-    BodyPart m_torso;
-    BodyPart m_head;
+    BodyPart m_body;
     BodyPart m_leftArm;
     BodyPart m_rightArm;
     BodyPart m_leftLeg;
     BodyPart m_rightLeg;
-    std::array<BodyPart*, 6> m_bodyParts;
+    std::array<BodyPart*, 5> m_bodyParts;
 };
 
 RenderUpdaterRegisterer<SteveAnimationUpdater> animationRegisterer((int)ERenderUpdaterOrder::PreRender);
@@ -0,0 +1,50 @@
+#include "RenderUpdaterOrder.hpp"
+
+#include "hatcher/ComponentAccessor.hpp"
+#include "hatcher/Graphics/RenderUpdater.hpp"
+
+#include "Components/PositionComponent.hpp"
+#include "RenderComponents/TransformComponent.hpp"
+#include "WorldComponents/VisibleEntities.hpp"
+#include "utils/TransformationHelper.hpp"
+
+using namespace hatcher;
+
+namespace
+{
+
+// Refreshes the transforms of whatever the scene may draw: visible moving entities, and every entity of the
+// visible static cells, since those are drawn by cell.
+class TransformRenderUpdater final : public RenderUpdater
+{
+public:
+    TransformRenderUpdater(const IRendering* rendering) {}
+
+    void Update(IApplication* application, const ComponentAccessor* componentAccessor,
+                ComponentAccessor* renderComponentAccessor, IFrameRenderer& frameRenderer) override
+    {
+        const auto positionComponents = componentAccessor->ReadComponents<PositionComponent>();
+        auto transformComponents = renderComponentAccessor->WriteComponents<TransformComponent>();
+        const VisibleEntities* visibleEntities = renderComponentAccessor->ReadWorldComponent<VisibleEntities>();
+
+        const auto Refresh = [&](Entity entity)
+        {
+            std::optional<TransformComponent>& transformComponent = transformComponents[entity];
+            const std::optional<PositionComponent>& positionComponent = positionComponents[entity];
+            if (transformComponent && positionComponent)
+                TransformationHelper::RefreshTransform(*transformComponent, *positionComponent);
+        };
+
+        for (Entity entity : visibleEntities->MovingEntities())
+            Refresh(entity);
+        for (int64_t cellKey : visibleEntities->VisibleCells())
+        {
+            for (const VisibleEntities::StaticEntry& entry : visibleEntities->Cell(cellKey).entries)
+                Refresh(entry.entity);
+        }
+    }
+};
+
+RenderUpdaterRegisterer<TransformRenderUpdater> registerer((int)ERenderUpdaterOrder::Transform);
+
+} // namespace
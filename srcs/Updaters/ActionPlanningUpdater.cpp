@@ -9,14 +9,19 @@
 #include "Components/PositionComponent.hpp"
 #include "Components/WorkerComponent.hpp"
 
+#include "WorldComponents/ComponentIndex.hpp"
+#include "WorldComponents/GroundStacks.hpp"
+#include "WorldComponents/PathPool.hpp"
 #include "WorldComponents/SquareGrid.hpp"
+#include "WorldComponents/TimerWheel.hpp"
+#include "WorldComponents/WorldClock.hpp"
 
 #include "utils/EntityFinder.hpp"
+#include "utils/ScheduledUpdater.hpp"
 #include "utils/TimeOfDay.hpp"
 
 #include "hatcher/ComponentAccessor.hpp"
 #include "hatcher/IEntityManager.hpp"
-#include "hatcher/Updater.hpp"
 
 #include <algorithm>
 
@@ -32,10 +37,8 @@ glm::vec2 GetStorageTarget(const ComponentAccessor* componentAccessor, Entity en
     HATCHER_ASSERT(employableComponent->employer);
     const Entity employer = *employableComponent->employer;
     const auto& businessComponent = componentAccessor->ReadComponents<BusinessComponent>()[employer];
-    const auto& positionComponent = componentAccessor->ReadComponents<PositionComponent>()[employer];
     HATCHER_ASSERT(businessComponent);
-    HATCHER_ASSERT(positionComponent);
-    return positionComponent->position + businessComponent->storagePosition;
+    return businessComponent->stockpile.position;
 }
 
 class IPlan
@@ -46,10 +49,10 @@ public:
     virtual bool IsOngoing(const ComponentAccessor* componentAccessor, Entity entity) const = 0;
 };
 
-bool IsEntityWood(const ComponentAccessor* componentAccessor, Entity entity)
+bool CarriesWood(const ComponentAccessor* componentAccessor, Entity entity)
 {
-    const auto nameComponent = componentAccessor->ReadComponents<NameComponent>()[entity];
-    return nameComponent && nameComponent->name == "Wood";
+    const InventoryComponent& inventory = *componentAccessor->ReadComponents<InventoryComponent>()[entity];
+    return ResourceCount(inventory.resources, EResource::Wood) > 0;
 }
 
 bool IsEntityAxe(const ComponentAccessor* componentAccessor, Entity entity)
@@ -64,15 +67,6 @@ bool IsAvailableEntityAxe(const ComponentAccessor* componentAccessor, Entity ent
            !componentAccessor->ReadComponents<LockableComponent>()[entity]->locker;
 }
 
-bool IsGatherableWood(const ComponentAccessor* componentAccessor, Entity entity)
-{
-    const auto& employableComponent = componentAccessor->ReadComponents<EmployableComponent>()[entity];
-    const auto& lockableComponent = componentAccessor->ReadComponents<LockableComponent>()[entity];
-    const auto& positionComponent = componentAccessor->ReadComponents<PositionComponent>()[entity];
-    return IsEntityWood(componentAccessor, entity) && positionComponent && !lockableComponent->locker &&
-           !employableComponent->employer;
-}
-
 bool ContainsAxe(const ComponentAccessor* componentAccessor, Entity entity)
 {
     const auto& inventoryComponent = componentAccessor->ReadComponents<InventoryComponent>()[entity];
@@ -99,6 +93,21 @@ bool IsChoppableTree(const ComponentAccessor* componentAccessor, Entity entity)
     return nameComponent && nameComponent->name == "Tree" && !lockableComponent->locker;
 }
 
+// Only named entities can be trees.
+Entity FindNearestChoppableTree(const ComponentAccessor* componentAccessor, Entity entity)
+{
+    const auto* componentIndex = componentAccessor->ReadWorldComponent<GameplayComponentIndex>();
+    return FindNearestEntity(componentAccessor, entity, componentIndex->EntitiesWith<NameComponent>(),
+                             IsChoppableTree);
+}
+
+Entity FindNearestAxeRack(const ComponentAccessor* componentAccessor, Entity entity)
+{
+    const auto* componentIndex = componentAccessor->ReadWorldComponent<GameplayComponentIndex>();
+    return FindNearestEntity(componentAccessor, entity, componentIndex->EntitiesWith<InventoryComponent>(),
+                             ContainsAvailableAxe);
+}
+
 class Wait : public IPlan
 {
     bool CanBeAchieved(const ComponentAccessor* componentAccessor, Entity entity) const override { return true; }
@@ -117,50 +126,18 @@ class DropOffWood : public IPlan
 {
     bool CanBeAchieved(const ComponentAccessor* componentAccessor, Entity entity) const override
     {
-        const InventoryComponent& inventory = *componentAccessor->ReadComponents<InventoryComponent>()[entity];
         const glm::vec2 position = componentAccessor->ReadComponents<PositionComponent>()[entity]->position;
         const glm::vec2 woodTarget = GetStorageTarget(componentAccessor, entity);
-        auto IsWood = [componentAccessor](Entity entity) { return IsEntityWood(componentAccessor, entity); };
-        return glm::length(position - woodTarget) <= 1.f &&
-               std::any_of(inventory.storage.begin(), inventory.storage.end(), IsWood);
+        return glm::length(position - woodTarget) <= 1.f && CarriesWood(componentAccessor, entity);
     }
 
     void Start(IEntityManager* entityManager, ComponentAccessor* componentAccessor, Entity entity) const override
     {
-        auto employables = componentAccessor->WriteComponents<EmployableComponent>();
-        auto positions = componentAccessor->WriteComponents<PositionComponent>();
-        auto items = componentAccessor->WriteComponents<ItemComponent>();
-
         InventoryComponent& inventory = *componentAccessor->WriteComponents<InventoryComponent>()[entity];
-        auto IsWood = [componentAccessor](Entity entity) { return IsEntityWood(componentAccessor, entity); };
-        auto it = std::find_if(inventory.storage.begin(), inventory.storage.end(), IsWood);
-        HATCHER_ASSERT(it != inventory.storage.end());
-        const Entity employer = *employables[entity]->employer;
-
-        const auto IsWoodStack = [employer](const ComponentAccessor* componentAccessor, Entity entity)
-        {
-            const auto& employableComponent = componentAccessor->ReadComponents<EmployableComponent>()[entity];
-            return IsEntityWood(componentAccessor, entity) && employableComponent &&
-                   employableComponent->employer == employer;
-        };
-        const Entity gatherableWood = FindNearestEntity(componentAccessor, entity, IsWoodStack);
-        if (gatherableWood == Entity::Invalid())
-        {
-            const glm::vec2 woodTarget = GetStorageTarget(componentAccessor, entity);
-            employables[*it]->employer = employer;
-            items[*it]->inventory = Entity::Invalid();
-            positions[*it] = PositionComponent{
-                .position = woodTarget,
-                .orientation = {1.f, 0.f},
-            };
-        }
-        else
-        {
-            items[gatherableWood]->count += items[*it]->count;
-            entityManager->DeleteEntity(Entity(*it));
-        }
-
-        inventory.storage.erase(it);
+        const Entity employer = *componentAccessor->ReadComponents<EmployableComponent>()[entity]->employer;
+        BusinessComponent& business = *componentAccessor->WriteComponents<BusinessComponent>()[employer];
+        const int count = TakeResource(inventory.resources, EResource::Wood);
+        AddResource(business.stockpile.resources, EResource::Wood, count);
     }
 
     bool IsOngoing(const ComponentAccessor* componentAccessor, Entity entity) const override { return false; }
@@ -170,9 +147,7 @@ class BringBackWood : public IPlan
 {
     bool CanBeAchieved(const ComponentAccessor* componentAccessor, Entity entity) const override
     {
-        const InventoryComponent& inventory = *componentAccessor->ReadComponents<InventoryComponent>()[entity];
-        auto IsWood = [componentAccessor](Entity entity) { return IsEntityWood(componentAccessor, entity); };
-        return std::any_of(inventory.storage.begin(), inventory.storage.end(), IsWood);
+        return CarriesWood(componentAccessor, entity);
     }
 
     void Start(IEntityManager* entityManager, ComponentAccessor* componentAccessor, Entity entity) const override
@@ -181,14 +156,14 @@ class BringBackWood : public IPlan
         const SquareGrid* grid = componentAccessor->ReadWorldComponent<SquareGrid>();
 
         const glm::vec2 woodTarget = GetStorageTarget(componentAccessor, entity);
-        std::vector<glm::vec2> path = grid->GetPathIfPossible(position, woodTarget, 1.f);
-        componentAccessor->WriteComponents<MovementComponent>()[entity]->path = path;
+        const std::vector<glm::vec2> path = grid->GetPathIfPossible(position, woodTarget, 1.f);
+        MovementComponent& movement = *componentAccessor->WriteComponents<MovementComponent>()[entity];
+        componentAccessor->WriteWorldComponent<PathPool>()->SetPath(movement, path);
     }
 
     bool IsOngoing(const ComponentAccessor* componentAccessor, Entity entity) const override
     {
-        const std::vector<glm::vec2>& path = componentAccessor->ReadComponents<MovementComponent>()[entity]->path;
-        return !path.empty();
+        return componentAccessor->ReadComponents<MovementComponent>()[entity]->remainingWaypoints > 0;
     }
 };
 
@@ -196,19 +171,18 @@ class TakeWood : public IPlan
 {
     bool CanBeAchieved(const ComponentAccessor* componentAccessor, Entity entity) const override
     {
-        const auto& positionComponents = componentAccessor->ReadComponents<PositionComponent>();
-        const Entity woodEntity = FindNearestEntity(componentAccessor, entity, IsGatherableWood);
-        return woodEntity != Entity::Invalid() &&
-               positionComponents[woodEntity]->position == positionComponents[entity]->position;
+        const glm::vec2 position = componentAccessor->ReadComponents<PositionComponent>()[entity]->position;
+        const GroundStacks* groundStacks = componentAccessor->ReadWorldComponent<GroundStacks>();
+        const GroundStacks::Stack* woodStack = groundStacks->FindNearestGatherable(position, EResource::Wood);
+        return woodStack && woodStack->position == position;
     }
 
     void Start(IEntityManager* entityManager, ComponentAccessor* componentAccessor, Entity entity) const override
     {
-        const Entity woodEntity = FindNearestEntity(componentAccessor, entity, IsGatherableWood);
+        const glm::vec2 position = componentAccessor->ReadComponents<PositionComponent>()[entity]->position;
+        const int count = componentAccessor->WriteWorldComponent<GroundStacks>()->Take(position, EResource::Wood);
         InventoryComponent& inventory = *componentAccessor->WriteComponents<InventoryComponent>()[entity];
-        inventory.storage.push_back(woodEntity);
-        componentAccessor->WriteComponents<PositionComponent>()[woodEntity] = {};
-        componentAccessor->WriteComponents<ItemComponent>()[woodEntity]->inventory = entity;
+        AddResource(inventory.resources, EResource::Wood, count);
     }
 
     bool IsOngoing(const ComponentAccessor* componentAccessor, Entity entity) const override { return false; }
@@ -218,29 +192,29 @@ class MoveToWood : public IPlan
 {
     bool CanBeAchieved(const ComponentAccessor* componentAccessor, Entity entity) const override
     {
-        const Entity woodEntity = FindNearestEntity(componentAccessor, entity, IsGatherableWood);
-        return woodEntity != Entity::Invalid();
+        const glm::vec2 position = componentAccessor->ReadComponents<PositionComponent>()[entity]->position;
+        const GroundStacks* groundStacks = componentAccessor->ReadWorldComponent<GroundStacks>();
+        return groundStacks->FindNearestGatherable(position, EResource::Wood) != nullptr;
     }
 
     void Start(IEntityManager* entityManager, ComponentAccessor* componentAccessor, Entity entity) const override
     {
-        const auto& positions = componentAccessor->ReadComponents<PositionComponent>();
-        const Entity woodEntity = FindNearestEntity(componentAccessor, entity, IsGatherableWood);
+        GroundStacks* groundStacks = componentAccessor->WriteWorldComponent<GroundStacks>();
         const SquareGrid* grid = componentAccessor->ReadWorldComponent<SquareGrid>();
 
-        const glm::vec2 position = positions[entity]->position;
-        const glm::vec2 woodPosition = positions[woodEntity]->position;
-        std::vector<glm::vec2> path = grid->GetPathIfPossible(position, woodPosition);
-        componentAccessor->WriteComponents<MovementComponent>()[entity]->path = path;
+        const glm::vec2 position = componentAccessor->ReadComponents<PositionComponent>()[entity]->position;
+        const glm::vec2 woodPosition = groundStacks->FindNearestGatherable(position, EResource::Wood)->position;
+        const std::vector<glm::vec2> path = grid->GetPathIfPossible(position, woodPosition);
+        MovementComponent& movement = *componentAccessor->WriteComponents<MovementComponent>()[entity];
+        componentAccessor->WriteWorldComponent<PathPool>()->SetPath(movement, path);
 
-        componentAccessor->WriteComponents<ActionPlanningComponent>()[entity]->lockedEntity = woodEntity;
-        componentAccessor->WriteComponents<LockableComponent>()[woodEntity]->locker = entity;
+        componentAccessor->WriteComponents<ActionPlanningComponent>()[entity]->lockedStack = woodPosition;
+        groundStacks->Lock(woodPosition, EResource::Wood, entity);
     }
 
     bool IsOngoing(const ComponentAccessor* componentAccessor, Entity entity) const override
     {
-        const std::vector<glm::vec2>& path = componentAccessor->ReadComponents<MovementComponent>()[entity]->path;
-        return !path.empty();
+        return componentAccessor->ReadComponents<MovementComponent>()[entity]->remainingWaypoints > 0;
     }
 };
 
@@ -251,7 +225,7 @@ class ChopTree : public IPlan
         if (!ContainsAxe(componentAccessor, entity))
             return false;
         const auto& positionComponents = componentAccessor->ReadComponents<PositionComponent>();
-        const Entity treeEntity = FindNearestEntity(componentAccessor, entity, IsChoppableTree);
+        const Entity treeEntity = FindNearestChoppableTree(componentAccessor, entity);
         return treeEntity != Entity::Invalid() &&
                glm::distance(positionComponents[treeEntity]->position, positionComponents[entity]->position) <= 1.f;
     }
@@ -259,13 +233,14 @@ class ChopTree : public IPlan
     void Start(IEntityManager* entityManager, ComponentAccessor* componentAccessor, Entity entity) const override
     {
         auto positionComponents = componentAccessor->WriteComponents<PositionComponent>();
-        const Entity treeEntity = FindNearestEntity(componentAccessor, entity, IsChoppableTree);
+        const Entity treeEntity = FindNearestChoppableTree(componentAccessor, entity);
 
         WorkerComponent& worker = *componentAccessor->WriteComponents<WorkerComponent>()[entity];
         worker.workIndex = EWork::ChopTree;
         worker.target = treeEntity;
-        worker.workedTicks = 0;
-        worker.workLength = MinutesToTicks(10);
+        const int currentTick = componentAccessor->ReadWorldComponent<WorldClock>()->tick;
+        worker.workTimer = componentAccessor->WriteWorldComponent<TimerWheel>()->Schedule(
+            currentTick + MinutesToTicks(10), entity, ETimerEvent::WorkDone);
 
         const glm::vec2 lumberjackPosition = positionComponents[entity]->position;
         const glm::vec2 treePosition = positionComponents[treeEntity]->position;
@@ -288,20 +263,21 @@ class MoveToTree : public IPlan
     {
         if (!ContainsAxe(componentAccessor, entity))
             return false;
-        const Entity treeEntity = FindNearestEntity(componentAccessor, entity, IsChoppableTree);
+        const Entity treeEntity = FindNearestChoppableTree(componentAccessor, entity);
         return treeEntity != Entity::Invalid();
     }
 
     void Start(IEntityManager* entityManager, ComponentAccessor* componentAccessor, Entity entity) const override
     {
         const auto& positions = componentAccessor->ReadComponents<PositionComponent>();
-        const Entity treeEntity = FindNearestEntity(componentAccessor, entity, IsChoppableTree);
+        const Entity treeEntity = FindNearestChoppableTree(componentAccessor, entity);
         const SquareGrid* grid = componentAccessor->ReadWorldComponent<SquareGrid>();
 
         const glm::vec2 position = positions[entity]->position;
         const glm::vec2 treePosition = positions[treeEntity]->position;
-        std::vector<glm::vec2> path = grid->GetPathIfPossible(position, treePosition, 1.f);
-        componentAccessor->WriteComponents<MovementComponent>()[entity]->path = path;
+        const std::vector<glm::vec2> path = grid->GetPathIfPossible(position, treePosition, 1.f);
+        MovementComponent& movement = *componentAccessor->WriteComponents<MovementComponent>()[entity];
+        componentAccessor->WriteWorldComponent<PathPool>()->SetPath(movement, path);
 
         componentAccessor->WriteComponents<ActionPlanningComponent>()[entity]->lockedEntity = treeEntity;
         componentAccessor->WriteComponents<LockableComponent>()[treeEntity]->locker = entity;
@@ -309,8 +285,7 @@ class MoveToTree : public IPlan
 
     bool IsOngoing(const ComponentAccessor* componentAccessor, Entity entity) const override
     {
-        const std::vector<glm::vec2>& path = componentAccessor->ReadComponents<MovementComponent>()[entity]->path;
-        return !path.empty();
+        return componentAccessor->ReadComponents<MovementComponent>()[entity]->remainingWaypoints > 0;
     }
 };
 
@@ -321,7 +296,7 @@ class GetAxe : public IPlan
         if (ContainsAxe(componentAccessor, entity))
             return false;
         const auto& positionComponents = componentAccessor->ReadComponents<PositionComponent>();
-        const Entity rackEntity = FindNearestEntity(componentAccessor, entity, ContainsAvailableAxe);
+        const Entity rackEntity = FindNearestAxeRack(componentAccessor, entity);
         return rackEntity != Entity::Invalid() &&
                glm::distance(positionComponents[rackEntity]->position, positionComponents[entity]->position) <= 1.f;
     }
@@ -329,7 +304,7 @@ class GetAxe : public IPlan
     void Start(IEntityManager* entityManager, ComponentAccessor* componentAccessor, Entity entity) const override
     {
         auto inventoryComponents = componentAccessor->WriteComponents<InventoryComponent>();
-        const Entity rackEntity = FindNearestEntity(componentAccessor, entity, ContainsAvailableAxe);
+        const Entity rackEntity = FindNearestAxeRack(componentAccessor, entity);
         HATCHER_ASSERT(rackEntity != Entity::Invalid());
         auto& rackInventory = inventoryComponents[rackEntity];
         HATCHER_ASSERT(rackInventory);
@@ -353,26 +328,26 @@ class MoveToAxe : public IPlan
     {
         if (ContainsAxe(componentAccessor, entity))
             return false;
-        const Entity rackEntity = FindNearestEntity(componentAccessor, entity, ContainsAvailableAxe);
+        const Entity rackEntity = FindNearestAxeRack(componentAccessor, entity);
         return rackEntity != Entity::Invalid();
     }
 
     void Start(IEntityManager* entityManager, ComponentAccessor* componentAccessor, Entity entity) const override
     {
         const auto& positions = componentAccessor->ReadComponents<PositionComponent>();
-        const Entity rackEntity = FindNearestEntity(componentAccessor, entity, ContainsAvailableAxe);
+        const Entity rackEntity = FindNearestAxeRack(componentAccessor, entity);
         const SquareGrid* grid = componentAccessor->ReadWorldComponent<SquareGrid>();
 
         const glm::vec2 position = positions[entity]->position;
         const glm::vec2 treePosition = positions[rackEntity]->position;
-        std::vector<glm::vec2> path = grid->GetPathIfPossible(position, treePosition, 1.f);
-        componentAccessor->WriteComponents<MovementComponent>()[entity]->path = path;
+        const std::vector<glm::vec2> path = grid->GetPathIfPossible(position, treePosition, 1.f);
+        MovementComponent& movement = *componentAccessor->WriteComponents<MovementComponent>()[entity];
+        componentAccessor->WriteWorldComponent<PathPool>()->SetPath(movement, path);
     }
 
     bool IsOngoing(const ComponentAccessor* componentAccessor, Entity entity) const override
     {
-        const std::vector<glm::vec2>& path = componentAccessor->ReadComponents<MovementComponent>()[entity]->path;
-        return !path.empty();
+        return componentAccessor->ReadComponents<MovementComponent>()[entity]->remainingWaypoints > 0;
     }
 };
 
@@ -412,6 +387,11 @@ void UpdatePlanning(ActionPlanningComponent& planning, IEntityManager* entityMan
             lockable->locker = {};
             planning.lockedEntity = {};
         }
+        if (planning.lockedStack)
+        {
+            componentAccessor->WriteWorldComponent<GroundStacks>()->Unlock(*planning.lockedStack, entity);
+            planning.lockedStack = {};
+        }
         planning.currentActionIndex = {};
         for (int planIndex = 0; planIndex < (int)std::size(plans); planIndex++)
         {
@@ -426,22 +406,36 @@ void UpdatePlanning(ActionPlanningComponent& planning, IEntityManager* entityMan
     }
 }
 
-class ActionPlanningUpdater final : public Updater
+class ActionPlanningUpdater final : public ScheduledUpdater
 {
+    ComponentAccess Access() const override
+    {
+        return ComponentAccess()
+            .Writes<ActionPlanningComponent, BusinessComponent, InventoryComponent, ItemComponent, LockableComponent>()
+            .Writes<MovementComponent, PositionComponent, WorkerComponent, GroundStacks, PathPool, TimerWheel>()
+            .Reads<EmployableComponent, NameComponent, GameplayComponentIndex, SquareGrid, WorldClock>();
+    }
+
     void Update(IEntityManager* entityManager, ComponentAccessor* componentAccessor) override
     {
         auto plannings = componentAccessor->WriteComponents<ActionPlanningComponent>();
+        const auto* componentIndex = componentAccessor->ReadWorldComponent<GameplayComponentIndex>();
 
-        for (int i = 0; i < componentAccessor->Count(); i++)
+        for (Entity entity : componentIndex->EntitiesWith<ActionPlanningComponent>())
         {
-            if (plannings[i])
+            if (plannings[entity])
             {
-                ActionPlanningComponent& planning = *plannings[i];
-                UpdatePlanning(planning, entityManager, componentAccessor, Entity(i));
+                ActionPlanningComponent& planning = *plannings[entity];
+                UpdatePlanning(planning, entityManager, componentAccessor, entity);
             }
         }
     }
 
+    EntityFilter DeletedEntityFilter() const override
+    {
+        return EntityFilter::AnyOf<ActionPlanningComponent, LockableComponent>();
+    }
+
     void OnDeletedEntity(Entity entity, IEntityManager* entityManager, ComponentAccessor* componentAccessor) override
     {
         {
@@ -452,6 +446,8 @@ class ActionPlanningUpdater final : public Updater
                 HATCHER_ASSERT(lockable);
                 lockable->locker = {};
             }
+            if (planning && planning->lockedStack)
+                componentAccessor->WriteWorldComponent<GroundStacks>()->Unlock(*planning->lockedStack, entity);
         }
         {
             const auto& lockable = componentAccessor->ReadComponents<LockableComponent>()[entity];
@@ -465,6 +461,6 @@ class ActionPlanningUpdater final : public Updater
     }
 };
 
-UpdaterRegisterer<ActionPlanningUpdater> registerer;
+ScheduledUpdaterRegisterer<ActionPlanningUpdater> registerer;
 
 } // namespace
@@ -1,76 +1,166 @@
 #include "Components/ActionPlanningComponent.hpp"
 #include "Components/BusinessComponent.hpp"
 #include "Components/EmployableComponent.hpp"
+#include "Components/PositionComponent.hpp"
+
+#include "WorldComponents/ComponentIndex.hpp"
+#include "WorldComponents/GroundStacks.hpp"
+
+#include "utils/ScheduledUpdater.hpp"
 
 #include "hatcher/ComponentAccessor.hpp"
-#include "hatcher/Updater.hpp"
 
-#include "utils/EntityFinder.hpp"
+#include <algorithm>
+#include <limits>
+#include <vector>
 
 using namespace hatcher;
 
 namespace
 {
 
-bool IsBusiness(const ComponentAccessor* componentAccessor, Entity entity)
+struct OpenBusiness
 {
-    ComponentReader<BusinessComponent> businesses = componentAccessor->ReadComponents<BusinessComponent>();
-    return businesses[entity].has_value();
-}
+    Entity entity;
+    glm::vec2 position;
+    int openings;
+};
 
-class BusinessUpdater final : public Updater
+// Gather every business still hiring once, then greedily give each unemployed its nearest open business.
+// Ties are broken on the lowest entity, as FindNearestEntity would.
+void HireUnemployed(ComponentAccessor* componentAccessor, std::vector<Entity>& candidates)
 {
-    void Update(IEntityManager* entityManager, ComponentAccessor* componentAccessor) override
+    ComponentWriter<ActionPlanningComponent> plannings = componentAccessor->WriteComponents<ActionPlanningComponent>();
+    ComponentWriter<BusinessComponent> businesses = componentAccessor->WriteComponents<BusinessComponent>();
+    ComponentWriter<EmployableComponent> employables = componentAccessor->WriteComponents<EmployableComponent>();
+    ComponentReader<PositionComponent> positions = componentAccessor->ReadComponents<PositionComponent>();
+    const auto* componentIndex = componentAccessor->ReadWorldComponent<GameplayComponentIndex>();
+
+    std::vector<OpenBusiness> openBusinesses;
+    for (Entity entity : componentIndex->EntitiesWith<BusinessComponent>())
     {
-        ComponentWriter<ActionPlanningComponent> plannings =
-            componentAccessor->WriteComponents<ActionPlanningComponent>();
-        ComponentWriter<BusinessComponent> businesses = componentAccessor->WriteComponents<BusinessComponent>();
-        ComponentWriter<EmployableComponent> employables = componentAccessor->WriteComponents<EmployableComponent>();
+        HATCHER_ASSERT(positions[entity]);
+        const BusinessComponent& business = *businesses[entity];
+        const int openings = business.traits->maxEmployees - static_cast<int>(business.employees.size());
+        if (openings > 0)
+            openBusinesses.push_back({entity, positions[entity]->position, openings});
+    }
 
-        for (int i = 0; i < componentAccessor->Count(); i++)
+    componentIndex->EntitiesWith<ActionPlanningComponent, EmployableComponent>(candidates);
+    for (Entity entity : candidates)
+    {
+        if (openBusinesses.empty())
+            break;
+        if (!employables[entity]->employer)
         {
-            if (plannings[i])
+            const glm::vec2 position = positions[entity]->position;
+            auto nearestBusiness = openBusinesses.end();
+            float minDistanceSq = std::numeric_limits<float>::max();
+            for (auto it = openBusinesses.begin(); it != openBusinesses.end(); ++it)
             {
-                EmployableComponent& employable = *employables[i];
-                if (!employable.employer)
+                const glm::vec2 diff = position - it->position;
+                const float distanceSq = diff.x * diff.x + diff.y * diff.y;
+                if (distanceSq < minDistanceSq)
                 {
-                    const Entity entity(i);
-                    Entity businessEntity = FindNearestEntity(componentAccessor, entity, IsBusiness);
-                    if (businessEntity != Entity::Invalid())
-                    {
-                        ActionPlanningComponent& planning = *plannings[i];
-                        BusinessComponent& business = *businesses[businessEntity];
-                        business.employees.push_back(entity);
-                        employable.employer = businessEntity;
-                        planning.agenda = business.agenda;
-                        planning.currentActionIndex = {};
-                        // TODO unlock lockable
-                        planning.lockedEntity = {};
-                    }
+                    minDistanceSq = distanceSq;
+                    nearestBusiness = it;
                 }
             }
+
+            ActionPlanningComponent& planning = *plannings[entity];
+            BusinessComponent& business = *businesses[nearestBusiness->entity];
+            business.employees.push_back(entity);
+            employables[entity]->employer = nearestBusiness->entity;
+            planning.agenda = business.traits->agenda;
+            planning.currentActionIndex = {};
+            // TODO unlock lockable
+            planning.lockedEntity = {};
+
+            nearestBusiness->openings -= 1;
+            if (nearestBusiness->openings == 0)
+                openBusinesses.erase(nearestBusiness);
         }
     }
+}
 
-    void OnDeletedEntity(Entity entity, IEntityManager* entityManager, ComponentAccessor* componentAccessor) override
+class BusinessUpdater final : public ScheduledUpdater
+{
+    ComponentAccess Access() const override
+    {
+        return ComponentAccess()
+            .Writes<ActionPlanningComponent, BusinessComponent, EmployableComponent>()
+            .Reads<PositionComponent, GameplayComponentIndex>();
+    }
+
+    void Update(IEntityManager* entityManager, ComponentAccessor* componentAccessor) override
     {
+        if (m_hiringNeeded)
         {
-            const auto& employable = componentAccessor->ReadComponents<EmployableComponent>()[entity];
+            HireUnemployed(componentAccessor, m_candidates);
+            m_hiringNeeded = false;
+        }
+    }
+
+    void OnWorldLoaded(IEntityManager* entityManager, ComponentAccessor* componentAccessor) override
+    {
+        m_hiringNeeded = true;
+    }
+
+    EntityFilter CreatedEntityFilter() const override
+    {
+        return EntityFilter::AnyOf<ActionPlanningComponent, BusinessComponent>();
+    }
+    EntityFilter DeletedEntityFilter() const override
+    {
+        return EntityFilter::AnyOf<EmployableComponent, BusinessComponent>();
+    }
+
+    void OnCreatedEntity(Entity entity, IEntityManager* entityManager, ComponentAccessor* componentAccessor) override
+    {
+        auto& business = componentAccessor->WriteComponents<BusinessComponent>()[entity];
+        if (business)
+            SetStockpilePosition(*business, entity, componentAccessor);
+        if (componentAccessor->ReadComponents<ActionPlanningComponent>()[entity] || business)
+            m_hiringNeeded = true;
+    }
+
+    void OnDeletedEntities(span<const Entity> entities, IEntityManager* entityManager,
+                           ComponentAccessor* componentAccessor) override
+    {
+        auto employables = componentAccessor->WriteComponents<EmployableComponent>();
+        auto plannings = componentAccessor->WriteComponents<ActionPlanningComponent>();
+        auto businesses = componentAccessor->WriteComponents<BusinessComponent>();
+
+        // Each employer loses all its deleted employees in a single pass over its list.
+        std::vector<Entity> deleted(entities.begin(), entities.end());
+        std::sort(deleted.begin(), deleted.end());
+        std::vector<Entity> employers;
+        for (Entity entity : deleted)
+        {
+            const auto& employable = employables[entity];
             if (employable && employable->employer)
+                employers.push_back(*employable->employer);
+        }
+        std::sort(employers.begin(), employers.end());
+        employers.erase(std::unique(employers.begin(), employers.end()), employers.end());
+        for (Entity employerEntity : employers)
+        {
+            auto& employer = businesses[employerEntity];
+            HATCHER_ASSERT(employer);
+            const auto IsDeleted = [&deleted](Entity employee)
             {
-                auto& employer = componentAccessor->WriteComponents<BusinessComponent>()[*employable->employer];
-                HATCHER_ASSERT(employer);
-                auto it = std::find(employer->employees.begin(), employer->employees.end(), entity);
-                HATCHER_ASSERT(it != employer->employees.end());
-                employer->employees.erase(it);
-            }
+                return std::binary_search(deleted.begin(), deleted.end(), employee);
+            };
+            std::vector<Entity>& employees = employer->employees;
+            employees.erase(std::remove_if(employees.begin(), employees.end(), IsDeleted), employees.end());
+            m_hiringNeeded = true;
         }
+
+        for (Entity entity : deleted)
         {
-            const auto& business = componentAccessor->ReadComponents<BusinessComponent>()[entity];
+            const auto& business = businesses[entity];
             if (business)
             {
-                auto employables = componentAccessor->WriteComponents<EmployableComponent>();
-                auto plannings = componentAccessor->WriteComponents<ActionPlanningComponent>();
                 for (Entity employe : business->employees)
                 {
                     HATCHER_ASSERT(employables[employe]);
@@ -81,11 +171,29 @@ class BusinessUpdater final : public Updater
                     // TODO unlock lockable
                     plannings[employe]->lockedEntity = {};
                 }
+                // What was stored is left on the ground, for anyone to gather.
+                GroundStacks* groundStacks = componentAccessor->WriteWorldComponent<GroundStacks>();
+                for (const ResourceStack& stack : business->stockpile.resources)
+                    groundStacks->Drop(business->stockpile.position, stack.resource, stack.count);
+                m_hiringNeeded = true;
             }
         }
     }
+
+    // Businesses do not move: their storage tile is known once for all.
+    static void SetStockpilePosition(BusinessComponent& business, Entity entity,
+                                     const ComponentAccessor* componentAccessor)
+    {
+        const auto& position = componentAccessor->ReadComponents<PositionComponent>()[entity];
+        HATCHER_ASSERT(position);
+        business.stockpile.position = position->position + business.traits->storagePosition;
+    }
+
+    // Only hire when the unemployed or business sets may have changed.
+    bool m_hiringNeeded = true;
+    std::vector<Entity> m_candidates;
 };
 
-UpdaterRegisterer<BusinessUpdater> registerer;
+ScheduledUpdaterRegisterer<BusinessUpdater> registerer;
 
 } // namespace
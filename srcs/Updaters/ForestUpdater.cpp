@@ -1,13 +1,14 @@
+#include "utils/ScheduledUpdater.hpp"
+
 #include "hatcher/ComponentAccessor.hpp"
 #include "hatcher/EntityDescriptorID.hpp"
-#include "hatcher/IEntityManager.hpp"
+#include "hatcher/EntityEgg.hpp"
 #include "hatcher/Maths/RandomGenerator.hpp"
-#include "hatcher/Updater.hpp"
 
 #include <vector>
 
 #include "Components/GrowableComponent.hpp"
-#include "Components/PositionComponent.hpp"
+#include "WorldComponents/EntityCommandBuffer.hpp"
 #include "WorldComponents/SquareGrid.hpp"
 
 using namespace hatcher;
@@ -16,38 +17,41 @@ namespace
 {
 constexpr float density = 0.05f;
 
-class ForestUpdater final : public Updater
+class ForestUpdater final : public GameplayHooks
 {
     void CreateWorld(int64_t seed, IEntityManager* entityManager, ComponentAccessor* componentAccessor) const override
     {
         RandomGenerator random(seed);
-        std::vector<glm::ivec2> positions;
-
         const SquareGrid* grid = componentAccessor->ReadWorldComponent<SquareGrid>();
+        const glm::ivec2 tileMin(grid->GetTileCoordMin());
+        const glm::ivec2 tileMax(grid->GetTileCoordMax());
+        const int rowLength = tileMax.x - tileMin.x;
+        std::vector<bool> forested(grid->TileCount(), false);
+        std::vector<glm::vec2> positions;
+
         int treesToCreate = grid->TileCount() * density;
+        positions.reserve(treesToCreate);
         while (treesToCreate-- > 0)
         {
-            EntityEgg tree = entityManager->CreateNewEntity(EntityDescriptorID::Create("Tree"));
-            const glm::ivec2 position = [&]()
+            glm::ivec2 position;
+            int tileIndex;
+            do
             {
-                glm::ivec2 result;
-                do
-                {
-                    const int x = random.RandomInt(grid->GetTileCoordMin().x, grid->GetTileCoordMax().x - 1);
-                    const int y = random.RandomInt(grid->GetTileCoordMin().y, grid->GetTileCoordMax().y - 1);
-                    result = {x, y};
-                } while (std::find(positions.begin(), positions.end(), result) != positions.end());
-                return result;
-            }();
-            positions.push_back(position);
-            tree.GetComponent<PositionComponent>()->position = grid->GetTileCenter(position);
-            tree.GetComponent<GrowableComponent>()->maturity = 1.f;
+                position.x = random.RandomInt(tileMin.x, tileMax.x - 1);
+                position.y = random.RandomInt(tileMin.y, tileMax.y - 1);
+                tileIndex = (position.y - tileMin.y) * rowLength + position.x - tileMin.x;
+            } while (forested[tileIndex]);
+            forested[tileIndex] = true;
+            positions.push_back(grid->GetTileCenter(position));
         }
-    }
 
-    void Update(IEntityManager* entityManager, ComponentAccessor* componentAccessor) override {}
+        // The whole forest in one batch, grown from the start.
+        const auto GrowTree = [](EntityEgg& tree) { tree.GetComponent<GrowableComponent>()->initialMaturity = 1.f; };
+        componentAccessor->WriteWorldComponent<EntityCommandBuffer>()->CreateEntities(
+            EntityDescriptorID::Create("Tree"), positions, GrowTree);
+    }
 };
 
-UpdaterRegisterer<ForestUpdater> registerer;
+GameplayHooksRegisterer<ForestUpdater> registerer;
 
 } // namespace
@@ -1,30 +1,27 @@
 #include "Components/GrowableComponent.hpp"
+#include "WorldComponents/WorldClock.hpp"
+
+#include "utils/ScheduledUpdater.hpp"
 
 #include "hatcher/ComponentAccessor.hpp"
-#include "hatcher/Updater.hpp"
 
 using namespace hatcher;
 
 namespace
 {
 
-class GrowableUpdater final : public Updater
+class GrowableUpdater final : public GameplayHooks
 {
-    void Update(IEntityManager* entityManager, ComponentAccessor* componentAccessor) override
+    EntityFilter CreatedEntityFilter() const override { return EntityFilter::AnyOf<GrowableComponent>(); }
+
+    void OnCreatedEntity(Entity entity, IEntityManager* entityManager, ComponentAccessor* componentAccessor) override
     {
-        ComponentWriter<GrowableComponent> growables = componentAccessor->WriteComponents<GrowableComponent>();
-
-        for (int i = 0; i < componentAccessor->Count(); i++)
-        {
-            if (growables[i])
-            {
-                GrowableComponent& growable = *growables[i];
-                growable.maturity = std::min(growable.maturity + 1.f / (float)growable.growthTime, 1.f);
-            }
-        }
+        auto& growableComponent = componentAccessor->WriteComponents<GrowableComponent>()[entity];
+        if (growableComponent)
+            growableComponent->plantingTick = componentAccessor->ReadWorldComponent<WorldClock>()->tick;
     }
 };
 
-UpdaterRegisterer<GrowableUpdater> registerer;
+GameplayHooksRegisterer<GrowableUpdater> registerer;
 
 } // namespace
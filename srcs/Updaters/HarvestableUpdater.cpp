@@ -1,20 +1,22 @@
 #include "Components/GrowableComponent.hpp"
 #include "Components/HarvestableComponent.hpp"
-#include "Components/ItemComponent.hpp"
 #include "Components/PositionComponent.hpp"
+#include "WorldComponents/GroundStacks.hpp"
+#include "WorldComponents/WorldClock.hpp"
+
+#include "utils/ScheduledUpdater.hpp"
 
 #include "hatcher/ComponentAccessor.hpp"
-#include "hatcher/EntityManager.hpp"
-#include "hatcher/Updater.hpp"
+#include "hatcher/assert.hpp"
 
 using namespace hatcher;
 
 namespace
 {
 
-class HarvestableUpdater final : public Updater
+class HarvestableUpdater final : public GameplayHooks
 {
-    void Update(IEntityManager* entityManager, ComponentAccessor* componentAccessor) override {}
+    EntityFilter DeletedEntityFilter() const override { return EntityFilter::AnyOf<HarvestableComponent>(); }
 
     void OnDeletedEntity(Entity entity, IEntityManager* entityManager, ComponentAccessor* componentAccessor) override
     {
@@ -23,25 +25,23 @@ class HarvestableUpdater final : public Updater
         {
             const auto positionComponent = componentAccessor->ReadComponents<PositionComponent>()[entity];
             const auto growableComponent = componentAccessor->ReadComponents<GrowableComponent>()[entity];
-            int amount = harvestableComponent->amount;
+            int amount = harvestableComponent->traits->amount;
             if (growableComponent)
-                amount *= growableComponent->maturity;
+            {
+                const int currentTick = componentAccessor->ReadWorldComponent<WorldClock>()->tick;
+                amount *= GetMaturity(*growableComponent, currentTick);
+            }
 
             if (amount > 0)
             {
                 HATCHER_ASSERT(positionComponent);
-                EntityEgg item = entityManager->CreateNewEntity(harvestableComponent->harvest);
-                item.GetComponent<PositionComponent>() = *positionComponent;
-                if (amount > 1)
-                {
-                    HATCHER_ASSERT(item.GetComponent<ItemComponent>());
-                    item.GetComponent<ItemComponent>()->count = amount;
-                }
+                componentAccessor->WriteWorldComponent<GroundStacks>()->Drop(
+                    positionComponent->position, harvestableComponent->traits->harvest, amount);
             }
         }
     }
 };
 
-UpdaterRegisterer<HarvestableUpdater> registerer;
+GameplayHooksRegisterer<HarvestableUpdater> registerer;
 
 } // namespace
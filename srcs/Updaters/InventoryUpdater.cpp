@@ -1,17 +1,18 @@
 #include "Components/InventoryComponent.hpp"
 #include "Components/PositionComponent.hpp"
 
+#include "utils/ScheduledUpdater.hpp"
+
 #include "hatcher/ComponentAccessor.hpp"
-#include "hatcher/Updater.hpp"
 
 using namespace hatcher;
 
 namespace
 {
 
-class InventoryUpdater final : public Updater
+class InventoryUpdater final : public GameplayHooks
 {
-    void Update(IEntityManager* entityManager, ComponentAccessor* componentAccessor) override {}
+    EntityFilter DeletedEntityFilter() const override { return EntityFilter::AnyOf<InventoryComponent>(); }
 
     void OnDeletedEntity(Entity entity, IEntityManager* entityManager, ComponentAccessor* componentAccessor) override
     {
@@ -32,6 +33,6 @@ class InventoryUpdater final : public Updater
     }
 };
 
-UpdaterRegisterer<InventoryUpdater> registerer;
+GameplayHooksRegisterer<InventoryUpdater> registerer;
 
 } // namespace
@@ -1,60 +1,96 @@
 #include "Components/MovementComponent.hpp"
 #include "Components/PositionComponent.hpp"
+#include "WorldComponents/ComponentIndex.hpp"
+#include "WorldComponents/PathPool.hpp"
+
+#include "utils/MovementKernel.hpp"
+#include "utils/ParallelFor.hpp"
+#include "utils/ScheduledUpdater.hpp"
 
 #include "hatcher/ComponentAccessor.hpp"
-#include "hatcher/Maths/glm_pure.hpp"
-#include "hatcher/Updater.hpp"
 
 using namespace hatcher;
 
 namespace
 {
+constexpr float movementPerTick = 0.05f;
 
-class MovingEntitiesUpdater final : public Updater
+class MovingEntitiesUpdater final : public ScheduledUpdater
 {
 public:
+    ComponentAccess Access() const override
+    {
+        return ComponentAccess()
+            .Writes<PositionComponent, MovementComponent, PathPool>()
+            .Reads<GameplayComponentIndex>();
+    }
+
     void Update(IEntityManager* entityManager, ComponentAccessor* componentAccessor) override
     {
-        ComponentWriter<PositionComponent> positions = componentAccessor->WriteComponents<PositionComponent>();
-        ComponentWriter<MovementComponent> movements = componentAccessor->WriteComponents<MovementComponent>();
+        auto positionComponents = componentAccessor->WriteComponents<PositionComponent>();
+        auto movementComponents = componentAccessor->WriteComponents<MovementComponent>();
+        PathPool* pathPool = componentAccessor->WriteWorldComponent<PathPool>();
+        const auto* componentIndex = componentAccessor->ReadWorldComponent<GameplayComponentIndex>();
+        const span<const Entity> entities = componentIndex->EntitiesWith<MovementComponent>();
 
-        for (int i = 0; i < componentAccessor->Count(); i++)
+        // Gathered, stepped and scattered by blocks, so that the buffers stay in registers and the L1 cache.
+        const auto MoveChunk = [&](int begin, int end, std::vector<Entity>& arrived)
         {
-            if (movements[i])
+            MoverBlock block;
+            int blockIndices[MOVER_BLOCK_SIZE];
+            const auto StepBlock = [&]()
             {
-                HATCHER_ASSERT(positions[i]);
-                float movementLength = 0.05f;
-                MovementComponent& movement2D = *movements[i];
-                PositionComponent& position2D = *positions[i];
-                if (!movement2D.path.empty())
+                block.StepTowardWaypoints(movementPerTick);
+                for (int i = 0; i < block.Count(); i++)
                 {
-                    const glm::vec2 startPosition = position2D.position;
-                    while (!movement2D.path.empty() && movementLength > 0.f)
+                    const Entity entity = entities[blockIndices[i]];
+                    PositionComponent& position2D = *positionComponents[entity];
+                    if (!block.ReachesWaypoint(i))
                     {
-                        glm::vec2 nextObjective = movement2D.path.back();
-                        const glm::vec2 direction = (nextObjective - position2D.position);
-                        const float distanceToNextObjective = glm::length(direction);
-                        if (distanceToNextObjective <= movementLength)
-                        {
-                            position2D.position = nextObjective;
-                            movement2D.path.pop_back();
-                            movementLength -= distanceToNextObjective;
-                        }
-                        else
-                        {
-                            position2D.position += glm::normalize(direction) * movementLength;
-                            movementLength = 0.f;
-                        }
+                        block.Get(i, position2D);
+                        continue;
                     }
-                    const float distance = glm::length(position2D.position - startPosition);
-                    if (distance > 0.001) // micro-steps give an absurd orientation because of floating precision.
-                        position2D.orientation = (position2D.position - startPosition) / distance;
+
+                    MovementComponent& movement2D = *movementComponents[entity];
+                    movement2D.remainingWaypoints =
+                        MoveAlongPath(position2D, pathPool->RemainingWaypoints(movement2D), movementPerTick);
+                    if (movement2D.remainingWaypoints == 0)
+                        arrived.push_back(entity);
                 }
+                block.Clear();
+            };
+
+            for (int i = begin; i < end; i++)
+            {
+                const Entity entity = entities[i];
+                const MovementComponent& movement2D = *movementComponents[entity];
+                if (!positionComponents[entity] || movement2D.remainingWaypoints == 0)
+                    continue;
+
+                const span<const glm::vec2> path = pathPool->RemainingWaypoints(movement2D);
+                blockIndices[block.Count()] = i;
+                block.Add(*positionComponents[entity], path[path.size() - 1]);
+                if (block.IsFull())
+                    StepBlock();
             }
-        }
+            if (block.Count() > 0)
+                StepBlock();
+        };
+        // The pool is not thread-safe: finished paths are released afterwards, in id order for a stable layout.
+        for (Entity entity : ParallelCollectChunks<Entity>(static_cast<int>(entities.size()), MoveChunk))
+            pathPool->ClearPath(*movementComponents[entity]);
+    }
+
+    EntityFilter DeletedEntityFilter() const override { return EntityFilter::AnyOf<MovementComponent>(); }
+
+    void OnDeletedEntity(Entity entity, IEntityManager* entityManager, ComponentAccessor* componentAccessor) override
+    {
+        auto& movementComponent = componentAccessor->WriteComponents<MovementComponent>()[entity];
+        if (movementComponent)
+            componentAccessor->WriteWorldComponent<PathPool>()->ClearPath(*movementComponent);
     }
 };
 
-UpdaterRegisterer<MovingEntitiesUpdater> registerer;
+ScheduledUpdaterRegisterer<MovingEntitiesUpdater> registerer;
 
 } // namespace
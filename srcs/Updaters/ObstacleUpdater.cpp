@@ -2,62 +2,66 @@
 #include "Components/PositionComponent.hpp"
 #include "WorldComponents/SquareGrid.hpp"
 
+#include "utils/ScheduledUpdater.hpp"
+
 #include "hatcher/ComponentAccessor.hpp"
-#include "hatcher/Updater.hpp"
 #include "hatcher/assert.hpp"
 
 using namespace hatcher;
 
 namespace
 {
-class ObstacleUpdater final : public Updater
+// Every tile covered by the obstacles among entities, expected to be walkable or not.
+std::vector<glm::vec2> ObstacleTiles(span<const Entity> entities, ComponentAccessor* componentAccessor,
+                                     bool expectedWalkable)
 {
-    void Update(IEntityManager* entityManager, ComponentAccessor* componentAccessor) override {}
-
-    virtual void OnCreatedEntity(Entity entity, IEntityManager* entityManager,
-                                 ComponentAccessor* componentAccessor) override
+    const auto obstacles = componentAccessor->ReadComponents<ObstacleComponent>();
+    const auto positions = componentAccessor->ReadComponents<PositionComponent>();
+    const SquareGrid* grid = componentAccessor->ReadWorldComponent<SquareGrid>();
+    std::vector<glm::vec2> tiles;
+    for (Entity entity : entities)
     {
-        const auto obstacle = componentAccessor->ReadComponents<ObstacleComponent>()[entity];
-        if (obstacle)
+        const auto& obstacle = obstacles[entity];
+        if (!obstacle)
+            continue;
+
+        const glm::vec2 position = positions[entity]->position;
+        const glm::vec2 positionMin = position + static_cast<glm::vec2>(obstacle->traits->area.Min());
+        const glm::vec2 positionMax = position + static_cast<glm::vec2>(obstacle->traits->area.Max());
+        for (float y = positionMin.y; y <= positionMax.y; y++)
         {
-            const glm::vec2 position = componentAccessor->ReadComponents<PositionComponent>()[entity]->position;
-            SquareGrid* grid = componentAccessor->WriteWorldComponent<SquareGrid>();
-            const glm::vec2 positionMin = position + static_cast<glm::vec2>(obstacle->area.Min());
-            const glm::vec2 positionMax = position + static_cast<glm::vec2>(obstacle->area.Max());
-            for (float y = positionMin.y; y <= positionMax.y; y++)
+            for (float x = positionMin.x; x <= positionMax.x; x++)
             {
-                for (float x = positionMin.x; x <= positionMax.x; x++)
-                {
-                    const glm::vec2 tilePosition(x, y);
-                    HATCHER_ASSERT(grid->GetTileData(tilePosition).walkable);
-                    grid->SetTileWalkable(tilePosition, false);
-                }
+                const glm::vec2 tilePosition(x, y);
+                HATCHER_ASSERT(grid->GetTileData(tilePosition).walkable == expectedWalkable);
+                tiles.push_back(tilePosition);
             }
         }
     }
+    return tiles;
+}
 
-    virtual void OnDeletedEntity(Entity entity, IEntityManager* entityManager,
-                                 ComponentAccessor* componentAccessor) override
+class ObstacleUpdater final : public GameplayHooks
+{
+    EntityFilter CreatedEntityFilter() const override { return EntityFilter::AnyOf<ObstacleComponent>(); }
+    EntityFilter DeletedEntityFilter() const override { return EntityFilter::AnyOf<ObstacleComponent>(); }
+
+    void OnCreatedEntities(span<const Entity> entities, IEntityManager* entityManager,
+                           ComponentAccessor* componentAccessor) override
     {
-        const auto obstacle = componentAccessor->ReadComponents<ObstacleComponent>()[entity];
-        if (obstacle)
-        {
-            const glm::vec2 position = componentAccessor->ReadComponents<PositionComponent>()[entity]->position;
-            SquareGrid* grid = componentAccessor->WriteWorldComponent<SquareGrid>();
-            const glm::vec2 positionMin = position + static_cast<glm::vec2>(obstacle->area.Min());
-            const glm::vec2 positionMax = position + static_cast<glm::vec2>(obstacle->area.Max());
-            for (float y = positionMin.y; y <= positionMax.y; y++)
-            {
-                for (float x = positionMin.x; x <= positionMax.x; x++)
-                {
-                    const glm::vec2 tilePosition(x, y);
-                    HATCHER_ASSERT(!grid->GetTileData(tilePosition).walkable);
-                    grid->SetTileWalkable(tilePosition, true);
-                }
-            }
-        }
+        const std::vector<glm::vec2> tiles = ObstacleTiles(entities, componentAccessor, true);
+        if (!tiles.empty())
+            componentAccessor->WriteWorldComponent<SquareGrid>()->SetTilesWalkable(tiles, false);
+    }
+
+    void OnDeletedEntities(span<const Entity> entities, IEntityManager* entityManager,
+                           ComponentAccessor* componentAccessor) override
+    {
+        const std::vector<glm::vec2> tiles = ObstacleTiles(entities, componentAccessor, false);
+        if (!tiles.empty())
+            componentAccessor->WriteWorldComponent<SquareGrid>()->SetTilesWalkable(tiles, true);
     }
 };
 
-UpdaterRegisterer<ObstacleUpdater> registerer;
+GameplayHooksRegisterer<ObstacleUpdater> registerer;
 } // namespace
@@ -0,0 +1,218 @@
+#include "Components/PositionComponent.hpp"
+#include "WorldComponents/ComponentIndex.hpp"
+#include "WorldComponents/EntityCommandBuffer.hpp"
+#include "WorldComponents/TimerWheel.hpp"
+#include "WorldComponents/WorldClock.hpp"
+
+#include "utils/ScheduledUpdater.hpp"
+#include "utils/ThreadPool.hpp"
+#include "utils/UpdaterStages.hpp"
+
+#include "hatcher/ComponentAccessor.hpp"
+#include "hatcher/EntityEgg.hpp"
+#include "hatcher/IEntityManager.hpp"
+#include "hatcher/Updater.hpp"
+#include "hatcher/assert.hpp"
+
+#include <set>
+#include <vector>
+
+using namespace hatcher;
+
+namespace
+{
+
+class UpdaterScheduler final : public Updater
+{
+public:
+    void CreateWorld(int64_t seed, IEntityManager* entityManager, ComponentAccessor* componentAccessor) const override
+    {
+        InstantiateUpdaters();
+        m_deferring = true;
+        for (GameplayHooks* hooks : m_hooks)
+        {
+            hooks->CreateWorld(seed, entityManager, componentAccessor);
+            ApplyStructuralChanges(entityManager, componentAccessor);
+        }
+        m_deferring = false;
+    }
+
+    void Update(IEntityManager* entityManager, ComponentAccessor* componentAccessor) override
+    {
+        InstantiateUpdaters();
+        m_deferring = true;
+        RefreshIndex(componentAccessor);
+        if (m_worldLoaded)
+        {
+            m_worldLoaded = false;
+            for (GameplayHooks* hooks : m_hooks)
+                hooks->OnWorldLoaded(entityManager, componentAccessor);
+            ApplyStructuralChanges(entityManager, componentAccessor);
+        }
+        const int currentTick = componentAccessor->ReadWorldComponent<WorldClock>()->tick;
+        componentAccessor->WriteWorldComponent<TimerWheel>()->Advance(currentTick);
+        for (const UpdaterStage& stage : m_stages)
+        {
+            RunUpdaterStage(GetThreadPool(), stage,
+                            [this, entityManager, componentAccessor](int updater)
+                            { m_updaters[updater]->Update(entityManager, componentAccessor); });
+            ApplyStructuralChanges(entityManager, componentAccessor);
+        }
+        m_deferring = false;
+        componentAccessor->WriteWorldComponent<WorldClock>()->tick = currentTick + 1;
+    }
+
+    void OnCreatedEntity(Entity entity, IEntityManager* entityManager, ComponentAccessor* componentAccessor) override
+    {
+        InstantiateUpdaters();
+        componentAccessor->WriteWorldComponent<GameplayComponentIndex>()->AddEntity(entity, componentAccessor);
+        m_createdEntities.push_back(entity);
+        if (!m_deferring)
+            ApplyStructuralChanges(entityManager, componentAccessor);
+    }
+
+    void OnDeletedEntity(Entity entity, IEntityManager* entityManager, ComponentAccessor* componentAccessor) override
+    {
+        InstantiateUpdaters();
+        // Deletions from the command buffer had their hooks called before reaching the entity manager.
+        if (m_deletionsDispatched.erase(entity) == 0)
+        {
+            const Entity deleted[] = {entity};
+            Dispatch(&GameplayHooks::OnDeletedEntities, m_deletedFilters, deleted, entityManager, componentAccessor);
+        }
+        componentAccessor->WriteWorldComponent<GameplayComponentIndex>()->RemoveEntity(entity);
+        if (!m_deferring)
+            ApplyStructuralChanges(entityManager, componentAccessor);
+    }
+
+private:
+    // Registerers from other translation units may run after ours, so wait for the first call.
+    void InstantiateUpdaters() const
+    {
+        if (!m_hooks.empty())
+            return;
+        std::vector<ComponentAccess> accesses;
+        for (const ScheduledUpdaterFactory& factory : ScheduledUpdaterFactories())
+        {
+            m_updaters.push_back(factory());
+            m_hooks.push_back(m_updaters.back().get());
+            accesses.push_back(m_updaters.back()->Access());
+        }
+        for (const GameplayHooksFactory& factory : GameplayHooksFactories())
+        {
+            m_hooksOnly.push_back(factory());
+            m_hooks.push_back(m_hooksOnly.back().get());
+        }
+        for (GameplayHooks* hooks : m_hooks)
+        {
+            m_createdFilters.push_back(hooks->CreatedEntityFilter());
+            m_deletedFilters.push_back(hooks->DeletedEntityFilter());
+        }
+        m_stages = BuildUpdaterStages(accesses);
+    }
+
+    using BatchHook = void (GameplayHooks::*)(span<const Entity> entities, IEntityManager* entityManager,
+                                              ComponentAccessor* componentAccessor);
+
+    // Gives each hooks object the entities passing its filter, skipping it if there are none.
+    void Dispatch(BatchHook hook, const std::vector<EntityFilter>& filters, span<const Entity> entities,
+                  IEntityManager* entityManager, ComponentAccessor* componentAccessor) const
+    {
+        const auto* componentIndex = componentAccessor->ReadWorldComponent<GameplayComponentIndex>();
+        std::vector<Entity> filtered;
+        for (std::size_t i = 0; i < m_hooks.size(); i++)
+        {
+            GameplayHooks* hooks = m_hooks[i];
+            const EntityFilter& filter = filters[i];
+            if (filter.AcceptsAll())
+            {
+                (hooks->*hook)(entities, entityManager, componentAccessor);
+                continue;
+            }
+
+            filtered.clear();
+            for (Entity entity : entities)
+            {
+                if (componentIndex->HasAnyOf(entity, filter.Slots(), componentAccessor))
+                    filtered.push_back(entity);
+            }
+            if (!filtered.empty())
+                (hooks->*hook)(filtered, entityManager, componentAccessor);
+        }
+    }
+
+    // Until nothing is left, since hooks may request more changes.
+    void ApplyStructuralChanges(IEntityManager* entityManager, ComponentAccessor* componentAccessor) const
+    {
+        const bool wasDeferring = m_deferring;
+        m_deferring = true;
+        EntityCommandBuffer* commandBuffer = componentAccessor->WriteWorldComponent<EntityCommandBuffer>();
+        while (!m_createdEntities.empty() || !commandBuffer->IsEmpty())
+        {
+            for (const EntityCommandBuffer::Creation& creation : commandBuffer->TakeCreations())
+                CreateEntities(creation, entityManager);
+
+            std::vector<Entity> created;
+            created.swap(m_createdEntities);
+            if (!created.empty())
+            {
+                Dispatch(&GameplayHooks::OnCreatedEntities, m_createdFilters, created, entityManager,
+                         componentAccessor);
+            }
+
+            const std::vector<Entity> deleted = commandBuffer->TakeDeletions();
+            if (!deleted.empty())
+            {
+                Dispatch(&GameplayHooks::OnDeletedEntities, m_deletedFilters, deleted, entityManager,
+                         componentAccessor);
+                m_deletionsDispatched.insert(deleted.begin(), deleted.end());
+                for (Entity entity : deleted)
+                    entityManager->DeleteEntity(entity);
+            }
+        }
+        RefreshIndex(componentAccessor);
+        m_deferring = wasDeferring;
+    }
+
+    // Updaters iterate the index member lists, which must hold every structural change so far.
+    // Entity hooks are not called on load, so the index is only rebuilt here.
+    void RefreshIndex(ComponentAccessor* componentAccessor) const
+    {
+        if (componentAccessor->WriteWorldComponent<GameplayComponentIndex>()->Refresh(componentAccessor))
+            m_worldLoaded = true;
+    }
+
+    // The entity manager creates entities one by one: batching only spares the hooks a call per entity.
+    void CreateEntities(const EntityCommandBuffer::Creation& creation, IEntityManager* entityManager) const
+    {
+        for (int i = 0; i < creation.Count(); i++)
+        {
+            EntityEgg egg = entityManager->CreateNewEntity(creation.descriptor);
+            if (!creation.positions.empty())
+            {
+                HATCHER_ASSERT(egg.GetComponent<PositionComponent>());
+                egg.GetComponent<PositionComponent>()->position = creation.positions[i];
+            }
+            if (creation.setup)
+                creation.setup(egg);
+        }
+    }
+
+    mutable std::vector<unique_ptr<ScheduledUpdater>> m_updaters;
+    mutable std::vector<unique_ptr<GameplayHooks>> m_hooksOnly;
+    // Updaters first, then hooks only.
+    mutable std::vector<GameplayHooks*> m_hooks;
+    mutable std::vector<UpdaterStage> m_stages;
+    // Indexed like m_hooks.
+    mutable std::vector<EntityFilter> m_createdFilters;
+    mutable std::vector<EntityFilter> m_deletedFilters;
+    // Set while updating, so that entity hooks wait for the end of the current stage.
+    mutable bool m_deferring = false;
+    mutable bool m_worldLoaded = false;
+    mutable std::vector<Entity> m_createdEntities;
+    mutable std::set<Entity> m_deletionsDispatched;
+};
+
+UpdaterRegisterer<UpdaterScheduler> registerer;
+
+} // namespace
@@ -1,8 +1,12 @@
 #include "Components/WorkerComponent.hpp"
 
+#include "WorldComponents/EntityCommandBuffer.hpp"
+#include "WorldComponents/TimerWheel.hpp"
+
+#include "utils/ScheduledUpdater.hpp"
+
 #include "hatcher/ComponentAccessor.hpp"
 #include "hatcher/IEntityManager.hpp"
-#include "hatcher/Updater.hpp"
 #include "hatcher/assert.hpp"
 
 #include <functional>
@@ -18,36 +22,45 @@ using Work = std::function<void(IEntityManager* entityManager, ComponentAccessor
 void ChopTree(IEntityManager* entityManager, ComponentAccessor* componentAccessor, std::optional<Entity> target)
 {
     HATCHER_ASSERT(target);
-    entityManager->DeleteEntity(*target);
+    componentAccessor->WriteWorldComponent<EntityCommandBuffer>()->DeleteEntity(*target);
 }
 
 Work works[] = {
     ChopTree,
 };
 
-class WorkerUpdater final : public Updater
+class WorkerUpdater final : public ScheduledUpdater
 {
+    ComponentAccess Access() const override
+    {
+        return ComponentAccess().Writes<WorkerComponent, EntityCommandBuffer, TimerWheel>();
+    }
+
     void Update(IEntityManager* entityManager, ComponentAccessor* componentAccessor) override
     {
         ComponentWriter<WorkerComponent> workers = componentAccessor->WriteComponents<WorkerComponent>();
+        TimerWheel* timerWheel = componentAccessor->WriteWorldComponent<TimerWheel>();
 
-        for (int i = 0; i < componentAccessor->Count(); i++)
+        for (Entity entity : timerWheel->TakeDue(ETimerEvent::WorkDone))
         {
-            if (workers[i] && workers[i]->workIndex)
-            {
-                WorkerComponent& worker = *workers[i];
-                worker.workedTicks += 1;
-                if (worker.workedTicks >= worker.workLength)
-                {
-                    EWork workIndex = *worker.workIndex;
-                    works[static_cast<int>(workIndex)](entityManager, componentAccessor, worker.target);
-                    worker.workIndex = {};
-                }
-            }
+            HATCHER_ASSERT(workers[entity] && workers[entity]->workIndex);
+            WorkerComponent& worker = *workers[entity];
+            EWork workIndex = *worker.workIndex;
+            works[static_cast<int>(workIndex)](entityManager, componentAccessor, worker.target);
+            worker.workIndex = {};
         }
     }
+
+    EntityFilter DeletedEntityFilter() const override { return EntityFilter::AnyOf<WorkerComponent>(); }
+
+    void OnDeletedEntity(Entity entity, IEntityManager* entityManager, ComponentAccessor* componentAccessor) override
+    {
+        const auto& workerComponent = componentAccessor->ReadComponents<WorkerComponent>()[entity];
+        if (workerComponent && workerComponent->workIndex)
+            componentAccessor->WriteWorldComponent<TimerWheel>()->Cancel(workerComponent->workTimer);
+    }
 };
 
-UpdaterRegisterer<WorkerUpdater> registerer;
+ScheduledUpdaterRegisterer<WorkerUpdater> registerer;
 
 } // namespace
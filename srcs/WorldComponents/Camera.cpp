@@ -37,6 +37,25 @@ glm::vec3 Camera::Up() const
     return up;
 }
 
+glm::mat4 Camera::ProjectionMatrix(glm::ivec2 resolution) const
+{
+    const float halfWidth = resolution.x / 2.f * pixelSize;
+    const float halfHeight = resolution.y / 2.f * pixelSize;
+
+    const float right = halfWidth;
+    const float left = -halfWidth;
+    const float bottom = -halfHeight;
+    const float top = halfHeight;
+    const float zNear = 0.1f;
+    const float zFar = 1000.f;
+    return glm::ortho(left, right, bottom, top, zNear, zFar);
+}
+
+glm::mat4 Camera::ViewMatrix() const
+{
+    return glm::lookAt(Position(), Target(), Up());
+}
+
 void Camera::Save(DataSaver& saver) const
 {
     saver << target;
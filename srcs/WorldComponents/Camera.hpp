@@ -25,6 +25,9 @@ struct Camera final : public IWorldComponent
     glm::vec3 Target() const;
     glm::vec3 Up() const;
 
+    glm::mat4 ProjectionMatrix(glm::ivec2 resolution) const;
+    glm::mat4 ViewMatrix() const;
+
     void Save(DataSaver& saver) const override;
     void Load(DataLoader& loader) override;
 };
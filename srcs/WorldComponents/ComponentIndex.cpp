@@ -0,0 +1,223 @@
+#include "ComponentIndex.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+
+#include "hatcher/assert.hpp"
+
+namespace
+{
+
+std::map<EComponentList, std::vector<HasComponentFunction>>& IndexedComponentTypes()
+{
+    static std::map<EComponentList, std::vector<HasComponentFunction>> types;
+    return types;
+}
+
+bool TestBit(const std::vector<uint64_t>& bits, Entity entity)
+{
+    const std::size_t word = entity.ID() / 64;
+    return word < bits.size() && (bits[word] >> (entity.ID() % 64)) & 1;
+}
+
+void SetBit(std::vector<uint64_t>& bits, Entity entity, bool value)
+{
+    const std::size_t word = entity.ID() / 64;
+    if (word >= bits.size())
+        bits.resize(word + 1, 0);
+    const uint64_t mask = uint64_t(1) << (entity.ID() % 64);
+    bits[word] = value ? (bits[word] | mask) : (bits[word] & ~mask);
+}
+
+bool IsLower(Entity a, Entity b)
+{
+    return a.ID() < b.ID();
+}
+
+} // namespace
+
+void RegisterIndexedComponent(EComponentList componentList, int slot, HasComponentFunction hasComponent)
+{
+    std::vector<HasComponentFunction>& types = IndexedComponentTypes()[componentList];
+    if (slot >= static_cast<int>(types.size()))
+        types.resize(slot + 1, nullptr);
+    HATCHER_ASSERT(!types[slot]);
+    types[slot] = hasComponent;
+}
+
+ComponentIndex::ComponentIndex(EComponentList componentList)
+    : m_componentList(componentList)
+{
+    const int typeCount = componentList == EComponentList::Gameplay ? GameplayIndexedComponents::count
+                                                                     : RenderingIndexedComponents::count;
+    const std::vector<HasComponentFunction>& types = IndexedComponentTypes()[componentList];
+    HATCHER_ASSERT(static_cast<int>(types.size()) == typeCount);
+    for (int slot = 0; slot < typeCount; slot++)
+    {
+        HATCHER_ASSERT(types[slot]);
+        m_types.push_back({.hasComponent = types[slot]});
+    }
+}
+
+bool ComponentIndex::HasAnyOf(Entity entity, const std::vector<int>& slots,
+                              const ComponentAccessor* componentAccessor) const
+{
+    for (int slot : slots)
+    {
+        HATCHER_ASSERT(slot >= 0 && slot < static_cast<int>(m_types.size()));
+        const TypeIndex& type = m_types[slot];
+        if (m_needsRebuild ? type.hasComponent(componentAccessor, entity) : TestBit(type.presence, entity))
+            return true;
+    }
+    return false;
+}
+
+void ComponentIndex::AddEntity(Entity entity, const ComponentAccessor* componentAccessor)
+{
+    for (TypeIndex& type : m_types)
+    {
+        if (!type.hasComponent(componentAccessor, entity) || TestBit(type.presence, entity))
+            continue;
+
+        SetBit(type.presence, entity, true);
+        if (TestBit(type.listed, entity))
+        {
+            // Still listed since its previous removal.
+            type.removedCount -= 1;
+            continue;
+        }
+        SetBit(type.listed, entity, true);
+        if (type.members.empty() || IsLower(type.members.back(), entity))
+            type.members.push_back(entity);
+        else
+            type.pending.insert(std::upper_bound(type.pending.begin(), type.pending.end(), entity, IsLower), entity);
+    }
+}
+
+void ComponentIndex::RemoveEntity(Entity entity)
+{
+    for (TypeIndex& type : m_types)
+    {
+        if (TestBit(type.presence, entity))
+        {
+            SetBit(type.presence, entity, false);
+            type.removedCount += 1;
+        }
+    }
+}
+
+void ComponentIndex::Prune(const ComponentAccessor* componentAccessor)
+{
+    for (TypeIndex& type : m_types)
+    {
+        for (const std::vector<Entity>* list : {&type.members, &type.pending})
+        {
+            for (Entity entity : *list)
+            {
+                if (TestBit(type.presence, entity) && !type.hasComponent(componentAccessor, entity))
+                {
+                    SetBit(type.presence, entity, false);
+                    type.removedCount += 1;
+                }
+            }
+        }
+    }
+}
+
+bool ComponentIndex::Refresh(const ComponentAccessor* componentAccessor)
+{
+    const bool rebuilt = m_needsRebuild;
+    if (m_needsRebuild)
+    {
+        for (TypeIndex& type : m_types)
+            type = {.hasComponent = type.hasComponent};
+        for (int i = 0; i < componentAccessor->Count(); i++)
+            AddEntity(Entity(i), componentAccessor);
+        m_needsRebuild = false;
+    }
+
+    bool changed = rebuilt;
+    for (TypeIndex& type : m_types)
+    {
+        if (type.pending.empty() && type.removedCount == 0)
+            continue;
+        changed = true;
+
+        std::vector<Entity> members;
+        members.reserve(type.members.size() + type.pending.size() - type.removedCount);
+        const auto IsPresent = [&type](Entity entity)
+        {
+            if (TestBit(type.presence, entity))
+                return true;
+            SetBit(type.listed, entity, false);
+            return false;
+        };
+        auto member = type.members.begin();
+        auto pending = type.pending.begin();
+        while (member != type.members.end() || pending != type.pending.end())
+        {
+            const bool takePending =
+                member == type.members.end() || (pending != type.pending.end() && IsLower(*pending, *member));
+            const Entity entity = takePending ? *pending++ : *member++;
+            if (IsPresent(entity))
+                members.push_back(entity);
+        }
+        type.members = std::move(members);
+        type.pending.clear();
+        type.removedCount = 0;
+    }
+    if (changed)
+        m_revision += 1;
+    return rebuilt;
+}
+
+span<const Entity> ComponentIndex::Members(EComponentList componentList, int slot) const
+{
+    HATCHER_ASSERT(componentList == m_componentList);
+    return m_types[slot].members;
+}
+
+void ComponentIndex::EntitiesWith(std::initializer_list<int> slots, std::vector<Entity>& entities) const
+{
+    const TypeIndex* driver = nullptr;
+    std::size_t driverSize = std::numeric_limits<std::size_t>::max();
+    for (int slot : slots)
+    {
+        const TypeIndex& type = m_types[slot];
+        const std::size_t size = type.members.size() + type.pending.size();
+        if (size < driverSize)
+        {
+            driver = &type;
+            driverSize = size;
+        }
+    }
+
+    const auto HasAll = [this, &slots](Entity entity)
+    {
+        for (int slot : slots)
+        {
+            if (!TestBit(m_types[slot].presence, entity))
+                return false;
+        }
+        return true;
+    };
+
+    entities.clear();
+    auto member = driver->members.begin();
+    auto pending = driver->pending.begin();
+    while (member != driver->members.end() || pending != driver->pending.end())
+    {
+        const bool takePending =
+            member == driver->members.end() || (pending != driver->pending.end() && IsLower(*pending, *member));
+        const Entity entity = takePending ? *pending++ : *member++;
+        if (HasAll(entity))
+            entities.push_back(entity);
+    }
+}
+
+namespace
+{
+WorldComponentTypeRegisterer<GameplayComponentIndex, EComponentList::Gameplay> gameplayRegisterer;
+WorldComponentTypeRegisterer<RenderComponentIndex, EComponentList::Rendering> renderingRegisterer;
+} // namespace
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+#include "hatcher/ComponentAccessor.hpp"
+#include "hatcher/ComponentRegisterer.hpp"
+#include "hatcher/Entity.hpp"
+#include "hatcher/IWorldComponent.hpp"
+#include "hatcher/assert.hpp"
+#include "hatcher/span.hpp"
+
+#include "IndexedComponents.hpp"
+
+using namespace hatcher;
+
+using HasComponentFunction = bool (*)(const ComponentAccessor* componentAccessor, Entity entity);
+
+void RegisterIndexedComponent(EComponentList componentList, int slot, HasComponentFunction hasComponent);
+
+// Presence bitset and sorted member list of every indexed component type, so that iterating rare components
+// costs their count rather than the world size.
+class ComponentIndex : public IWorldComponent
+{
+public:
+    // Entities owning the component, in id order. Additions and removals show once the index is refreshed.
+    // Invalidated by the next refresh.
+    template <class Component>
+    span<const Entity> EntitiesWith() const
+    {
+        return Members(IndexedComponentSlot<Component>::componentList, IndexedComponentSlot<Component>::slot);
+    }
+
+    // Fills entities with those owning all given components, in id order.
+    template <class... Components>
+    void EntitiesWith(std::vector<Entity>& entities) const
+    {
+        static_assert(sizeof...(Components) > 1, "Use the span overload for a single component.");
+        HATCHER_ASSERT(((IndexedComponentSlot<Components>::componentList == m_componentList) && ...));
+        EntitiesWith({IndexedComponentSlot<Components>::slot...}, entities);
+    }
+
+    // Checked on the presence bits, or on the components themselves while waiting for a rebuild.
+    bool HasAnyOf(Entity entity, const std::vector<int>& slots, const ComponentAccessor* componentAccessor) const;
+
+    void AddEntity(Entity entity, const ComponentAccessor* componentAccessor);
+    void RemoveEntity(Entity entity);
+    // Forgets entities which lost their components, for lists without a deletion hook.
+    void Prune(const ComponentAccessor* componentAccessor);
+    // Rebuilds the index after a load, and merges additions and removals into the member lists.
+    // Returns whether it was rebuilt.
+    bool Refresh(const ComponentAccessor* componentAccessor);
+    // Changed by every refresh that added or removed a member.
+    int Revision() const { return m_revision; }
+
+    void Save(DataSaver& saver) const override {}
+    void Load(DataLoader& loader) override { m_needsRebuild = true; }
+
+protected:
+    ComponentIndex(EComponentList componentList);
+
+private:
+    struct TypeIndex
+    {
+        HasComponentFunction hasComponent;
+        std::vector<uint64_t> presence;
+        std::vector<uint64_t> listed;
+        // Both sorted. Members may still hold removed entities until the next Refresh.
+        std::vector<Entity> members;
+        std::vector<Entity> pending;
+        int removedCount = 0;
+    };
+
+    span<const Entity> Members(EComponentList componentList, int slot) const;
+    void EntitiesWith(std::initializer_list<int> slots, std::vector<Entity>& entities) const;
+
+    EComponentList m_componentList;
+    std::vector<TypeIndex> m_types;
+    bool m_needsRebuild = true;
+    int m_revision = 0;
+};
+
+class GameplayComponentIndex final : public ComponentIndex
+{
+public:
+    GameplayComponentIndex(int64_t seed)
+        : ComponentIndex(EComponentList::Gameplay)
+    {
+    }
+};
+
+class RenderComponentIndex final : public ComponentIndex
+{
+public:
+    RenderComponentIndex(int64_t seed)
+        : ComponentIndex(EComponentList::Rendering)
+    {
+    }
+};
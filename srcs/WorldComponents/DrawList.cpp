@@ -0,0 +1,76 @@
+#include "DrawList.hpp"
+
+#include <algorithm>
+
+#include "hatcher/ComponentRegisterer.hpp"
+#include "hatcher/Graphics/IFrameRenderer.hpp"
+#include "hatcher/Graphics/Mesh.hpp"
+
+namespace
+{
+// A frame only uses a handful of materials and meshes.
+template <class State>
+int OrderOf(std::vector<const State*>& addedStates, const State* state)
+{
+    const auto it = std::find(addedStates.begin(), addedStates.end(), state);
+    if (it != addedStates.end())
+        return static_cast<int>(it - addedStates.begin());
+    addedStates.push_back(state);
+    return static_cast<int>(addedStates.size()) - 1;
+}
+} // namespace
+
+void DrawList::Add(const Material* material, const Mesh* mesh, const glm::mat4& modelMatrix)
+{
+    AddDraw(material, mesh, nullptr, m_matrices.size(), 1);
+    m_matrices.push_back(modelMatrix);
+}
+
+void DrawList::AddBatch(const Material* material, const Mesh* mesh, span<const glm::mat4> modelMatrices)
+{
+    if (!modelMatrices.empty())
+        AddDraw(material, mesh, modelMatrices.data(), 0, modelMatrices.size());
+}
+
+void DrawList::Submit(IFrameRenderer& frameRenderer)
+{
+    // Stable, so that draws of the same mesh keep the order they were added in.
+    const auto ByState = [](const Draw& a, const Draw& b)
+    { return a.materialOrder != b.materialOrder ? a.materialOrder < b.materialOrder : a.meshOrder < b.meshOrder; };
+    std::stable_sort(m_draws.begin(), m_draws.end(), ByState);
+
+    m_materialBindCount = 0;
+    m_drawCount = 0;
+    const Material* boundMaterial = nullptr;
+    for (const Draw& draw : m_draws)
+    {
+        if (draw.material != boundMaterial)
+        {
+            frameRenderer.PrepareSceneDraw(draw.material);
+            boundMaterial = draw.material;
+            m_materialBindCount += 1;
+        }
+        const glm::mat4* modelMatrices = draw.modelMatrices ? draw.modelMatrices : m_matrices.data() + draw.offset;
+        for (std::size_t i = 0; i < draw.count; i++)
+            draw.mesh->Draw(modelMatrices[i]);
+        m_drawCount += static_cast<int>(draw.count);
+    }
+
+    m_draws.clear();
+    m_matrices.clear();
+    m_addedMaterials.clear();
+    m_addedMeshes.clear();
+}
+
+void DrawList::AddDraw(const Material* material, const Mesh* mesh, const glm::mat4* modelMatrices,
+                       std::size_t offset, std::size_t count)
+{
+    const int materialOrder = OrderOf(m_addedMaterials, material);
+    const int meshOrder = OrderOf(m_addedMeshes, mesh);
+    m_draws.push_back({material, mesh, materialOrder, meshOrder, modelMatrices, offset, count});
+}
+
+namespace
+{
+WorldComponentTypeRegisterer<DrawList, EComponentList::Rendering> registerer;
+} // namespace
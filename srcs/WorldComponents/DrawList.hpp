@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "hatcher/IWorldComponent.hpp"
+#include "hatcher/Maths/glm_pure.hpp"
+#include "hatcher/span.hpp"
+
+namespace hatcher
+{
+class IFrameRenderer;
+class Material;
+class Mesh;
+} // namespace hatcher
+
+using namespace hatcher;
+
+// This frame's scene draws, submitted grouped by material then mesh, in the order each was first added, so that
+// each material is bound once.
+// Batching only saves material binds: the engine Mesh has no instanced draw, so each matrix is still its own draw.
+class DrawList final : public IWorldComponent
+{
+public:
+    DrawList(int64_t seed) {}
+
+    void Add(const Material* material, const Mesh* mesh, const glm::mat4& modelMatrix);
+    // The matrices are not copied: they must stay alive and unchanged until the list is submitted.
+    void AddBatch(const Material* material, const Mesh* mesh, span<const glm::mat4> modelMatrices);
+
+    // Draws and forgets every draw added since the last submission.
+    void Submit(IFrameRenderer& frameRenderer);
+
+    // Of the last submission.
+    int MaterialBindCount() const { return m_materialBindCount; }
+    int DrawCount() const { return m_drawCount; }
+
+    void Save(DataSaver& saver) const override {}
+    void Load(DataLoader& loader) override {}
+
+private:
+    struct Draw
+    {
+        const Material* material;
+        const Mesh* mesh;
+        // Order in which the material and the mesh were first added this frame, to sort on instead of addresses.
+        int materialOrder;
+        int meshOrder;
+        // Null for matrices copied in the list, found at offset in m_matrices.
+        const glm::mat4* modelMatrices;
+        std::size_t offset;
+        std::size_t count;
+    };
+
+    void AddDraw(const Material* material, const Mesh* mesh, const glm::mat4* modelMatrices, std::size_t offset,
+                 std::size_t count);
+
+    std::vector<Draw> m_draws;
+    std::vector<const Material*> m_addedMaterials;
+    std::vector<const Mesh*> m_addedMeshes;
+    std::vector<glm::mat4> m_matrices;
+    int m_materialBindCount = 0;
+    int m_drawCount = 0;
+};
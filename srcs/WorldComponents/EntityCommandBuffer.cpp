@@ -0,0 +1,44 @@
+#include "EntityCommandBuffer.hpp"
+
+#include <algorithm>
+
+#include "hatcher/ComponentRegisterer.hpp"
+#include "hatcher/assert.hpp"
+
+void EntityCommandBuffer::CreateEntity(const EntityDescriptorID& descriptor, Setup setup)
+{
+    m_creations.push_back({descriptor, {}, std::move(setup)});
+}
+
+void EntityCommandBuffer::CreateEntities(const EntityDescriptorID& descriptor, span<const glm::vec2> positions,
+                                         Setup setup)
+{
+    if (!positions.empty())
+        m_creations.push_back({descriptor, {positions.begin(), positions.end()}, std::move(setup)});
+}
+
+void EntityCommandBuffer::DeleteEntity(Entity entity)
+{
+    m_deletions.push_back(entity);
+}
+
+std::vector<EntityCommandBuffer::Creation> EntityCommandBuffer::TakeCreations()
+{
+    std::vector<Creation> creations;
+    creations.swap(m_creations);
+    return creations;
+}
+
+std::vector<Entity> EntityCommandBuffer::TakeDeletions()
+{
+    std::vector<Entity> deletions;
+    deletions.swap(m_deletions);
+    std::sort(deletions.begin(), deletions.end(), [](Entity a, Entity b) { return a.ID() < b.ID(); });
+    deletions.erase(std::unique(deletions.begin(), deletions.end()), deletions.end());
+    return deletions;
+}
+
+namespace
+{
+WorldComponentTypeRegisterer<EntityCommandBuffer, EComponentList::Gameplay> registerer;
+} // namespace
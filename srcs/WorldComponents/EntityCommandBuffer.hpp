@@ -0,0 +1,56 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "hatcher/Entity.hpp"
+#include "hatcher/EntityDescriptorID.hpp"
+#include "hatcher/IWorldComponent.hpp"
+#include "hatcher/Maths/glm_pure.hpp"
+#include "hatcher/span.hpp"
+
+namespace hatcher
+{
+class EntityEgg;
+}
+
+using namespace hatcher;
+
+// Entity creations and deletions requested during updates. The UpdaterScheduler applies them after each updater,
+// so that entity hooks are called once per batch rather than in the middle of an update.
+class EntityCommandBuffer final : public IWorldComponent
+{
+public:
+    using Setup = std::function<void(EntityEgg& egg)>;
+
+    struct Creation
+    {
+        EntityDescriptorID descriptor;
+        // One entity at each position, or a single one keeping its descriptor position.
+        std::vector<glm::vec2> positions;
+        Setup setup;
+
+        int Count() const { return positions.empty() ? 1 : static_cast<int>(positions.size()); }
+    };
+
+    EntityCommandBuffer(int64_t seed) {}
+
+    void CreateEntity(const EntityDescriptorID& descriptor, Setup setup = {});
+    // Setup runs on each entity, after its position was set.
+    void CreateEntities(const EntityDescriptorID& descriptor, span<const glm::vec2> positions, Setup setup = {});
+    // Deleting the same entity twice before the buffer is applied deletes it once.
+    void DeleteEntity(Entity entity);
+
+    bool IsEmpty() const { return m_creations.empty() && m_deletions.empty(); }
+    std::vector<Creation> TakeCreations();
+    // In id order.
+    std::vector<Entity> TakeDeletions();
+
+    // Applied within the tick it is filled in, so there is never anything to save.
+    void Save(DataSaver& saver) const override {}
+    void Load(DataLoader& loader) override {}
+
+private:
+    std::vector<Creation> m_creations;
+    std::vector<Entity> m_deletions;
+};
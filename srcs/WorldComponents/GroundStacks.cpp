@@ -0,0 +1,130 @@
+#include "GroundStacks.hpp"
+
+#include <algorithm>
+
+#include "hatcher/ComponentRegisterer.hpp"
+#include "hatcher/DataLoader.hpp"
+#include "hatcher/DataSaver.hpp"
+#include "hatcher/assert.hpp"
+
+#include "utils/SaveFormat.hpp"
+
+void GroundStacks::Drop(glm::vec2 position, EResource resource, int count)
+{
+    HATCHER_ASSERT(count > 0);
+    for (Stack& stack : m_stacks)
+    {
+        if (stack.position == position && stack.resource == resource)
+        {
+            stack.count += count;
+            return;
+        }
+    }
+    m_stacks.push_back({position, resource, count, {}});
+}
+
+int GroundStacks::Take(glm::vec2 position, EResource resource)
+{
+    const auto IsTaken = [position, resource](const Stack& stack)
+    {
+        return stack.position == position && stack.resource == resource;
+    };
+    const auto it = std::find_if(m_stacks.begin(), m_stacks.end(), IsTaken);
+    if (it == m_stacks.end())
+        return 0;
+    const int count = it->count;
+    m_stacks.erase(it);
+    return count;
+}
+
+const GroundStacks::Stack* GroundStacks::FindNearestGatherable(glm::vec2 position, EResource resource) const
+{
+    const Stack* nearest = nullptr;
+    float nearestDistance = 0.f;
+    for (const Stack& stack : m_stacks)
+    {
+        if (stack.resource != resource || stack.locker)
+            continue;
+        const float distance = glm::distance(position, stack.position);
+        if (!nearest || distance < nearestDistance)
+        {
+            nearest = &stack;
+            nearestDistance = distance;
+        }
+    }
+    return nearest;
+}
+
+void GroundStacks::Lock(glm::vec2 position, EResource resource, Entity locker)
+{
+    const auto IsLocked = [position, resource](const Stack& stack)
+    {
+        return stack.position == position && stack.resource == resource;
+    };
+    const auto it = std::find_if(m_stacks.begin(), m_stacks.end(), IsLocked);
+    HATCHER_ASSERT(it != m_stacks.end());
+    HATCHER_ASSERT(!it->locker);
+    it->locker = locker;
+}
+
+void GroundStacks::Unlock(glm::vec2 position, Entity locker)
+{
+    for (Stack& stack : m_stacks)
+    {
+        if (stack.position == position && stack.locker == locker)
+            stack.locker = {};
+    }
+}
+
+void GroundStacks::Save(DataSaver& saver) const
+{
+    SaveFormat::WriteVersion(saver);
+    std::vector<glm::vec2> positions;
+    std::vector<int> resources, counts;
+    std::vector<Entity> lockers;
+    for (const Stack& stack : m_stacks)
+    {
+        positions.push_back(stack.position);
+        resources.push_back(static_cast<int>(stack.resource));
+        counts.push_back(stack.count);
+        lockers.push_back(stack.locker.value_or(Entity::Invalid()));
+    }
+    saver << positions;
+    saver << resources;
+    saver << counts;
+    saver << lockers;
+}
+
+void GroundStacks::Load(DataLoader& loader)
+{
+    SaveFormat::CheckVersion(loader);
+    std::vector<glm::vec2> positions;
+    std::vector<int> resources, counts;
+    std::vector<Entity> lockers;
+    loader >> positions;
+    loader >> resources;
+    loader >> counts;
+    loader >> lockers;
+
+    const auto OptionalEntity = [](Entity entity) -> std::optional<Entity>
+    {
+        if (entity == Entity::Invalid())
+            return {};
+        return entity;
+    };
+    m_stacks.clear();
+    for (std::size_t i = 0; i < positions.size(); i++)
+    {
+        m_stacks.push_back({
+            .position = positions[i],
+            .resource = static_cast<EResource>(resources[i]),
+            .count = counts[i],
+            .locker = OptionalEntity(lockers[i]),
+        });
+    }
+}
+
+namespace
+{
+WorldComponentTypeRegisterer<GroundStacks, EComponentList::Gameplay> registerer;
+} // namespace
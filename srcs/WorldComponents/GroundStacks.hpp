@@ -0,0 +1,47 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "hatcher/Entity.hpp"
+#include "hatcher/IWorldComponent.hpp"
+#include "hatcher/Maths/glm_pure.hpp"
+
+#include "Components/ResourceStack.hpp"
+
+using namespace hatcher;
+
+// Resources lying on the ground, as counted stacks rather than entities, for anyone to gather.
+// What businesses store is in their BusinessComponent stockpile instead.
+class GroundStacks final : public IWorldComponent
+{
+public:
+    struct Stack
+    {
+        glm::vec2 position;
+        EResource resource;
+        int count;
+        std::optional<Entity> locker;
+    };
+
+    GroundStacks(int64_t seed) {}
+
+    // Merges into the stack of the same resource at this position, if there is one.
+    void Drop(glm::vec2 position, EResource resource, int count);
+    // Empties the stack of this resource at this position, returning how many there were.
+    int Take(glm::vec2 position, EResource resource);
+
+    // Nearest unlocked stack of this resource, nullptr if there is none.
+    const Stack* FindNearestGatherable(glm::vec2 position, EResource resource) const;
+    void Lock(glm::vec2 position, EResource resource, Entity locker);
+    // Releases the stacks at this position locked by locker, if they are still there.
+    void Unlock(glm::vec2 position, Entity locker);
+
+    const std::vector<Stack>& Stacks() const { return m_stacks; }
+
+    void Save(DataSaver& saver) const override;
+    void Load(DataLoader& loader) override;
+
+private:
+    std::vector<Stack> m_stacks;
+};
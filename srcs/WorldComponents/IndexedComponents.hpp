@@ -0,0 +1,66 @@
+#pragma once
+
+#include <type_traits>
+
+#include "hatcher/ComponentRegisterer.hpp"
+
+using namespace hatcher;
+
+struct ActionPlanningComponent;
+struct BusinessComponent;
+struct EmployableComponent;
+struct GrowableComponent;
+struct HarvestableComponent;
+struct InventoryComponent;
+struct ItemComponent;
+struct LockableComponent;
+struct MovementComponent;
+struct NameComponent;
+struct ObstacleComponent;
+struct WorkerComponent;
+
+struct ItemDisplayComponent;
+struct SelectableComponent;
+struct StaticMeshComponent;
+struct SteveAnimationComponent;
+
+template <class... Components>
+struct IndexedComponentList
+{
+    static constexpr int count = sizeof...(Components);
+
+    // Position of the component in the list, -1 if it is not listed.
+    template <class Component>
+    static constexpr int SlotOf()
+    {
+        int slot = -1;
+        int index = 0;
+        ((slot = std::is_same_v<Component, Components> ? index : slot, index++), ...);
+        return slot;
+    }
+};
+
+// Only types whose presence is fixed by the entity descriptor can be indexed.
+// PositionComponent is not: items lose it when stored in an inventory.
+using GameplayIndexedComponents =
+    IndexedComponentList<ActionPlanningComponent, BusinessComponent, EmployableComponent, GrowableComponent,
+                         HarvestableComponent, InventoryComponent, ItemComponent, LockableComponent, MovementComponent,
+                         NameComponent, ObstacleComponent, WorkerComponent>;
+using RenderingIndexedComponents =
+    IndexedComponentList<ItemDisplayComponent, SelectableComponent, StaticMeshComponent, SteveAnimationComponent>;
+
+template <class Component>
+constexpr bool isIndexedComponent =
+    GameplayIndexedComponents::SlotOf<Component>() >= 0 || RenderingIndexedComponents::SlotOf<Component>() >= 0;
+
+template <class Component>
+struct IndexedComponentSlot
+{
+    static_assert(isIndexedComponent<Component>, "Component is not listed as indexed.");
+    static constexpr int gameplaySlot = GameplayIndexedComponents::SlotOf<Component>();
+    static constexpr int renderingSlot = RenderingIndexedComponents::SlotOf<Component>();
+
+    static constexpr EComponentList componentList =
+        gameplaySlot >= 0 ? EComponentList::Gameplay : EComponentList::Rendering;
+    static constexpr int slot = gameplaySlot >= 0 ? gameplaySlot : renderingSlot;
+};
@@ -0,0 +1,198 @@
+#include "PathPool.hpp"
+
+#include <algorithm>
+#include <functional>
+
+#include "hatcher/ComponentRegisterer.hpp"
+#include "hatcher/DataLoader.hpp"
+#include "hatcher/DataSaver.hpp"
+#include "hatcher/assert.hpp"
+
+#include "utils/SaveFormat.hpp"
+
+namespace
+{
+int SizeClass(int size)
+{
+    int sizeClass = 0;
+    while ((1 << sizeClass) < size)
+        sizeClass++;
+    return sizeClass;
+}
+} // namespace
+
+void PathPool::SetPath(MovementComponent& movement, span<const glm::vec2> path)
+{
+    const int previousHandle = movement.pathHandle;
+    movement.pathHandle = path.empty() ? -1 : Acquire(path);
+    movement.remainingWaypoints = static_cast<int>(path.size());
+    // Released after acquiring, so that giving the same path again does not free it in between.
+    if (previousHandle >= 0)
+        Release(previousHandle);
+}
+
+void PathPool::ClearPath(MovementComponent& movement)
+{
+    if (movement.pathHandle >= 0)
+        Release(movement.pathHandle);
+    movement.pathHandle = -1;
+    movement.remainingWaypoints = 0;
+}
+
+span<const glm::vec2> PathPool::RemainingWaypoints(const MovementComponent& movement) const
+{
+    if (movement.pathHandle < 0)
+        return {};
+    const Run& run = m_runs[movement.pathHandle];
+    HATCHER_ASSERT(movement.remainingWaypoints <= run.size);
+    return span<const glm::vec2>(m_waypoints.data() + run.offset, movement.remainingWaypoints);
+}
+
+int PathPool::Acquire(span<const glm::vec2> path)
+{
+    const std::size_t hash = Hash(path);
+    const auto sameHashes = m_handlesByHash.equal_range(hash);
+    for (auto it = sameHashes.first; it != sameHashes.second; ++it)
+    {
+        Run& run = m_runs[it->second];
+        const glm::vec2* waypoints = m_waypoints.data() + run.offset;
+        if (run.size == static_cast<int>(path.size()) && std::equal(path.begin(), path.end(), waypoints))
+        {
+            run.references += 1;
+            return it->second;
+        }
+    }
+
+    int handle;
+    if (m_freeHandles.empty())
+    {
+        handle = static_cast<int>(m_runs.size());
+        m_runs.emplace_back();
+    }
+    else
+    {
+        handle = m_freeHandles.back();
+        m_freeHandles.pop_back();
+    }
+
+    Run& run = m_runs[handle];
+    run.sizeClass = SizeClass(path.size());
+    run.offset = AllocateWaypoints(run.sizeClass);
+    run.size = static_cast<int>(path.size());
+    run.references = 1;
+    std::copy(path.begin(), path.end(), m_waypoints.begin() + run.offset);
+    m_handlesByHash.emplace(hash, handle);
+    return handle;
+}
+
+void PathPool::Release(int handle)
+{
+    Run& run = m_runs[handle];
+    HATCHER_ASSERT(run.references > 0);
+    run.references -= 1;
+    if (run.references > 0)
+        return;
+
+    const std::size_t hash = Hash(span<const glm::vec2>(m_waypoints.data() + run.offset, run.size));
+    const auto sameHashes = m_handlesByHash.equal_range(hash);
+    const auto IsReleased = [handle](const std::pair<const std::size_t, int>& entry) { return entry.second == handle; };
+    m_handlesByHash.erase(std::find_if(sameHashes.first, sameHashes.second, IsReleased));
+
+    m_freeOffsets[run.sizeClass].push_back(run.offset);
+    m_freeHandles.push_back(handle);
+}
+
+int PathPool::AllocateWaypoints(int sizeClass)
+{
+    if (sizeClass >= static_cast<int>(m_freeOffsets.size()))
+        m_freeOffsets.resize(sizeClass + 1);
+
+    std::vector<int>& freeOffsets = m_freeOffsets[sizeClass];
+    if (!freeOffsets.empty())
+    {
+        const int offset = freeOffsets.back();
+        freeOffsets.pop_back();
+        return offset;
+    }
+    const int offset = static_cast<int>(m_waypoints.size());
+    m_waypoints.resize(m_waypoints.size() + (std::size_t(1) << sizeClass));
+    return offset;
+}
+
+std::size_t PathPool::Hash(span<const glm::vec2> path) const
+{
+    std::size_t hash = path.size();
+    for (const glm::vec2& waypoint : path)
+    {
+        hash = hash * 31 + std::hash<float>()(waypoint.x);
+        hash = hash * 31 + std::hash<float>()(waypoint.y);
+    }
+    return hash;
+}
+
+void PathPool::Save(DataSaver& saver) const
+{
+    SaveFormat::WriteVersion(saver);
+    std::vector<int> offsets, sizeClasses, sizes, references;
+    for (const Run& run : m_runs)
+    {
+        offsets.push_back(run.offset);
+        sizeClasses.push_back(run.sizeClass);
+        sizes.push_back(run.size);
+        references.push_back(run.references);
+    }
+    std::vector<int> freeOffsets, freeSizeClasses;
+    for (std::size_t sizeClass = 0; sizeClass < m_freeOffsets.size(); sizeClass++)
+    {
+        for (int offset : m_freeOffsets[sizeClass])
+        {
+            freeOffsets.push_back(offset);
+            freeSizeClasses.push_back(sizeClass);
+        }
+    }
+    saver << m_waypoints;
+    saver << offsets;
+    saver << sizeClasses;
+    saver << sizes;
+    saver << references;
+    saver << m_freeHandles;
+    saver << freeOffsets;
+    saver << freeSizeClasses;
+}
+
+void PathPool::Load(DataLoader& loader)
+{
+    SaveFormat::CheckVersion(loader);
+    std::vector<int> offsets, sizeClasses, sizes, references;
+    std::vector<int> freeOffsets, freeSizeClasses;
+    loader >> m_waypoints;
+    loader >> offsets;
+    loader >> sizeClasses;
+    loader >> sizes;
+    loader >> references;
+    loader >> m_freeHandles;
+    loader >> freeOffsets;
+    loader >> freeSizeClasses;
+
+    m_runs.clear();
+    m_handlesByHash.clear();
+    for (std::size_t handle = 0; handle < offsets.size(); handle++)
+    {
+        m_runs.push_back({offsets[handle], sizeClasses[handle], sizes[handle], references[handle]});
+        const Run& run = m_runs.back();
+        if (run.references > 0)
+            m_handlesByHash.emplace(Hash(span<const glm::vec2>(m_waypoints.data() + run.offset, run.size)), handle);
+    }
+    m_freeOffsets.clear();
+    for (std::size_t i = 0; i < freeOffsets.size(); i++)
+    {
+        if (freeSizeClasses[i] >= static_cast<int>(m_freeOffsets.size()))
+            m_freeOffsets.resize(freeSizeClasses[i] + 1);
+        m_freeOffsets[freeSizeClasses[i]].push_back(freeOffsets[i]);
+    }
+}
+
+namespace
+{
+WorldComponentTypeRegisterer<PathPool, EComponentList::Gameplay> registerer;
+} // namespace
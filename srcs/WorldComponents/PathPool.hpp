@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+#include "hatcher/IWorldComponent.hpp"
+#include "hatcher/Maths/glm_pure.hpp"
+#include "hatcher/span.hpp"
+
+#include "Components/MovementComponent.hpp"
+
+using namespace hatcher;
+
+// Every movement path in one waypoint arena. Runs are recycled by power-of-two size class, and identical paths
+// are stored once and shared by reference count.
+class PathPool final : public IWorldComponent
+{
+public:
+    PathPool(int64_t seed) {}
+
+    // Gives movement a reversed path (the next step is the last element), releasing its previous one.
+    void SetPath(MovementComponent& movement, span<const glm::vec2> path);
+    void ClearPath(MovementComponent& movement);
+    // Reversed too: the next step is the last element.
+    span<const glm::vec2> RemainingWaypoints(const MovementComponent& movement) const;
+
+    void Save(DataSaver& saver) const override;
+    void Load(DataLoader& loader) override;
+
+private:
+    struct Run
+    {
+        int offset;
+        int sizeClass;
+        int size;
+        int references;
+    };
+
+    int Acquire(span<const glm::vec2> path);
+    void Release(int handle);
+    int AllocateWaypoints(int sizeClass);
+    std::size_t Hash(span<const glm::vec2> path) const;
+
+    std::vector<glm::vec2> m_waypoints;
+    std::vector<Run> m_runs;
+    std::vector<int> m_freeHandles;
+    // Free offsets, indexed by size class.
+    std::vector<std::vector<int>> m_freeOffsets;
+    std::unordered_multimap<std::size_t, int> m_handlesByHash;
+};
@@ -1,5 +1,7 @@
 #include "SquareGrid.hpp"
 
+#include <unordered_set>
+
 #include "hatcher/ComponentRegisterer.hpp"
 #include "hatcher/DataLoader.hpp"
 #include "hatcher/DataSaver.hpp"
@@ -23,13 +25,16 @@ SquareGrid::TileData SquareGrid::defaultTile = {
 SquareGrid::SquareGrid(int64_t seed)
 {
     m_tilesData.fill(defaultTile);
+    std::vector<glm::vec2> tilePositions;
+    tilePositions.reserve(TILE_COUNT);
     for (int y = MIN_HEIGHT; y < MAX_HEIGHT; y++)
     {
         for (int x = MIN_WIDTH; x < MAX_WIDTH; x++)
         {
-            SetTileWalkable({x, y}, true);
+            tilePositions.emplace_back(x, y);
         }
     }
+    SetTilesWalkable(tilePositions, true);
 }
 
 SquareGrid::~SquareGrid() = default;
@@ -63,31 +68,51 @@ std::vector<glm::vec2> SquareGrid::GetPathIfPossible(glm::vec2 start, glm::vec2
 
 void SquareGrid::SetTileWalkable(glm::vec2 position, bool walkable)
 {
-    HATCHER_ASSERT(HasTileData(position));
-    const glm::vec2 tilePosition = GetTileCenter(position);
-    TileData& data = GetData(tilePosition);
-    if (data.walkable == walkable)
+    SetTilesWalkable({position}, walkable);
+}
+
+void SquareGrid::SetTilesWalkable(const std::vector<glm::vec2>& positions, bool walkable)
+{
+    std::vector<glm::vec2> changedTiles;
+    std::unordered_set<int> changedTileIndices;
+    for (glm::vec2 position : positions)
+    {
+        HATCHER_ASSERT(HasTileData(position));
+        const glm::vec2 tilePosition = GetTileCenter(position);
+        TileData& data = GetData(tilePosition);
+        if (data.walkable != walkable)
+        {
+            data.walkable = walkable;
+            changedTiles.push_back(tilePosition);
+            changedTileIndices.insert(CoordToTileIndex(tilePosition));
+        }
+    }
+    if (changedTiles.empty())
         return;
 
-    data.walkable = walkable;
-    if (walkable)
+    if (!walkable)
+    {
+        m_pathfinding.DeleteNodes(changedTiles);
+        return;
+    }
+
+    m_pathfinding.CreateNodes(changedTiles);
+    std::vector<std::pair<glm::vec2, glm::vec2>> links;
+    for (glm::vec2 tilePosition : changedTiles)
     {
-        m_pathfinding.CreateNode(tilePosition);
         for (glm::vec2 neighbour : tileNeighbours)
         {
             const glm::vec2 neighbourPosition = tilePosition + neighbour;
             if (HasTileData(neighbourPosition) && GetTileData(neighbourPosition).walkable)
             {
-                m_pathfinding.LinkNodes(tilePosition, neighbourPosition);
-                m_pathfinding.LinkNodes(neighbourPosition, tilePosition);
+                links.emplace_back(tilePosition, neighbourPosition);
+                // A new neighbour adds this link itself.
+                if (changedTileIndices.count(CoordToTileIndex(neighbourPosition)) == 0)
+                    links.emplace_back(neighbourPosition, tilePosition);
             }
         }
     }
-    else
-    {
-        if (m_pathfinding.ContainsNode(tilePosition))
-            m_pathfinding.DeleteNode(tilePosition);
-    }
+    m_pathfinding.LinkNodes(links);
 }
 
 void SquareGrid::Save(DataSaver& saver) const
@@ -34,6 +34,8 @@ public:
     std::vector<glm::vec2> GetPathIfPossible(glm::vec2 start, glm::vec2 end, float distance = 0.f) const;
 
     void SetTileWalkable(glm::vec2 position, bool walkable);
+    // Updates the pathfinding once for all the tiles.
+    void SetTilesWalkable(const std::vector<glm::vec2>& positions, bool walkable);
 
     void Save(DataSaver& saver) const override;
     void Load(DataLoader& loader) override;
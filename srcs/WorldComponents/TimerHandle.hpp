@@ -0,0 +1,8 @@
+#pragma once
+
+// A timer of the TimerWheel. Stale once the timer fired or was cancelled, as its slot gets a new generation.
+struct TimerHandle
+{
+    int index = -1;
+    int generation = 0;
+};
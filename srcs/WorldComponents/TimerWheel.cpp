@@ -0,0 +1,209 @@
+#include "TimerWheel.hpp"
+
+#include "hatcher/ComponentRegisterer.hpp"
+#include "hatcher/DataLoader.hpp"
+#include "hatcher/DataSaver.hpp"
+#include "hatcher/assert.hpp"
+
+#include "utils/SaveFormat.hpp"
+#include "utils/TimeOfDay.hpp"
+
+namespace
+{
+constexpr int tickSlotCount = MinutesToTicks(1);
+constexpr int minuteSlotCount = HoursToTicks(1) / MinutesToTicks(1);
+constexpr int hourSlotCount = DaysToTicks(1) / HoursToTicks(1);
+} // namespace
+
+TimerWheel::TimerWheel(int64_t seed)
+    : m_tickSlots(tickSlotCount)
+    , m_minuteSlots(minuteSlotCount)
+    , m_hourSlots(hourSlotCount)
+{
+}
+
+TimerHandle TimerWheel::Schedule(int dueTick, Entity entity, ETimerEvent event)
+{
+    int index;
+    if (m_freeIndices.empty())
+    {
+        index = static_cast<int>(m_timers.size());
+        m_timers.push_back({0, Entity::Invalid(), ETimerEvent::WorkDone, 0, false});
+    }
+    else
+    {
+        index = m_freeIndices.back();
+        m_freeIndices.pop_back();
+    }
+
+    Timer& timer = m_timers[index];
+    timer.dueTick = dueTick;
+    timer.entity = entity;
+    timer.event = event;
+    timer.scheduled = true;
+    const TimerHandle handle = {index, timer.generation};
+    Insert(handle);
+    return handle;
+}
+
+void TimerWheel::Cancel(TimerHandle handle)
+{
+    if (IsScheduled(handle))
+        Free(handle.index);
+}
+
+TimerHandle TimerWheel::Reschedule(TimerHandle handle, int dueTick)
+{
+    HATCHER_ASSERT(IsScheduled(handle));
+    const Timer timer = m_timers[handle.index];
+    // The freed index is reused with its new generation, leaving the old handle stale where it was queued.
+    Free(handle.index);
+    return Schedule(dueTick, timer.entity, timer.event);
+}
+
+bool TimerWheel::IsScheduled(TimerHandle handle) const
+{
+    return handle.index >= 0 && handle.index < static_cast<int>(m_timers.size()) &&
+           m_timers[handle.index].generation == handle.generation && m_timers[handle.index].scheduled;
+}
+
+void TimerWheel::Advance(int tick)
+{
+    while (m_nextTick <= tick)
+    {
+        const int currentTick = m_nextTick;
+        // From the coarsest wheel, so that cascaded timers can land in the slots cascaded next.
+        if (currentTick % DaysToTicks(1) == 0)
+            Cascade(m_overflow);
+        if (currentTick % HoursToTicks(1) == 0)
+            Cascade(m_hourSlots[currentTick / HoursToTicks(1) % hourSlotCount]);
+        if (currentTick % MinutesToTicks(1) == 0)
+            Cascade(m_minuteSlots[currentTick / MinutesToTicks(1) % minuteSlotCount]);
+
+        std::vector<TimerHandle>& slot = m_tickSlots[currentTick % tickSlotCount];
+        for (TimerHandle handle : slot)
+        {
+            if (IsScheduled(handle))
+                m_due.push_back(handle);
+        }
+        slot.clear();
+        m_nextTick += 1;
+    }
+}
+
+std::vector<Entity> TimerWheel::TakeDue(ETimerEvent event)
+{
+    std::vector<Entity> entities;
+    std::vector<TimerHandle> remaining;
+    for (TimerHandle handle : m_due)
+    {
+        if (!IsScheduled(handle))
+            continue;
+        if (m_timers[handle.index].event == event)
+        {
+            entities.push_back(m_timers[handle.index].entity);
+            Free(handle.index);
+        }
+        else
+        {
+            remaining.push_back(handle);
+        }
+    }
+    m_due = std::move(remaining);
+    return entities;
+}
+
+void TimerWheel::Insert(TimerHandle handle)
+{
+    const int dueTick = m_timers[handle.index].dueTick;
+    const int delay = dueTick - m_nextTick;
+    if (delay < 0)
+        m_due.push_back(handle);
+    else if (delay < MinutesToTicks(1))
+        m_tickSlots[dueTick % tickSlotCount].push_back(handle);
+    else if (delay < HoursToTicks(1))
+        m_minuteSlots[dueTick / MinutesToTicks(1) % minuteSlotCount].push_back(handle);
+    else if (delay < DaysToTicks(1))
+        m_hourSlots[dueTick / HoursToTicks(1) % hourSlotCount].push_back(handle);
+    else
+        m_overflow.push_back(handle);
+}
+
+void TimerWheel::Cascade(std::vector<TimerHandle>& slot)
+{
+    std::vector<TimerHandle> handles;
+    handles.swap(slot);
+    for (TimerHandle handle : handles)
+    {
+        if (IsScheduled(handle))
+            Insert(handle);
+    }
+}
+
+void TimerWheel::Free(int index)
+{
+    m_timers[index].scheduled = false;
+    m_timers[index].generation += 1;
+    m_freeIndices.push_back(index);
+}
+
+void TimerWheel::Save(DataSaver& saver) const
+{
+    SaveFormat::WriteVersion(saver);
+    std::vector<int> dueTicks, events, generations, scheduled;
+    std::vector<Entity> entities;
+    for (const Timer& timer : m_timers)
+    {
+        dueTicks.push_back(timer.dueTick);
+        entities.push_back(timer.entity);
+        events.push_back(static_cast<int>(timer.event));
+        generations.push_back(timer.generation);
+        scheduled.push_back(timer.scheduled);
+    }
+    saver << m_nextTick;
+    saver << dueTicks;
+    saver << entities;
+    saver << events;
+    saver << generations;
+    saver << scheduled;
+    saver << m_freeIndices;
+}
+
+void TimerWheel::Load(DataLoader& loader)
+{
+    SaveFormat::CheckVersion(loader);
+    std::vector<int> dueTicks, events, generations, scheduled;
+    std::vector<Entity> entities;
+    loader >> m_nextTick;
+    loader >> dueTicks;
+    loader >> entities;
+    loader >> events;
+    loader >> generations;
+    loader >> scheduled;
+    loader >> m_freeIndices;
+
+    // Slots are rebuilt from the scheduled timers, keeping their handles valid.
+    m_tickSlots.assign(tickSlotCount, {});
+    m_minuteSlots.assign(minuteSlotCount, {});
+    m_hourSlots.assign(hourSlotCount, {});
+    m_overflow.clear();
+    m_due.clear();
+    m_timers.clear();
+    for (std::size_t i = 0; i < dueTicks.size(); i++)
+    {
+        m_timers.push_back({
+            .dueTick = dueTicks[i],
+            .entity = entities[i],
+            .event = static_cast<ETimerEvent>(events[i]),
+            .generation = generations[i],
+            .scheduled = scheduled[i] != 0,
+        });
+        if (m_timers.back().scheduled)
+            Insert({static_cast<int>(i), generations[i]});
+    }
+}
+
+namespace
+{
+WorldComponentTypeRegisterer<TimerWheel, EComponentList::Gameplay> registerer;
+} // namespace
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <vector>
+
+#include "hatcher/Entity.hpp"
+#include "hatcher/IWorldComponent.hpp"
+
+#include "TimerHandle.hpp"
+
+using namespace hatcher;
+
+enum class ETimerEvent
+{
+    WorkDone,
+};
+
+// Delayed events keyed by tick, in a minute wheel of ticks, an hour wheel of minutes and a day wheel of hours.
+// Timers further than a day wait in an overflow list. Advancing costs one slot per tick, whatever the timer count.
+class TimerWheel final : public IWorldComponent
+{
+public:
+    TimerWheel(int64_t seed);
+
+    TimerHandle Schedule(int dueTick, Entity entity, ETimerEvent event);
+    void Cancel(TimerHandle handle);
+    // Cancels the timer and schedules it again at dueTick, for the same entity and event.
+    TimerHandle Reschedule(TimerHandle handle, int dueTick);
+    bool IsScheduled(TimerHandle handle) const;
+
+    // Moves every timer due until tick, included, to the due list.
+    void Advance(int tick);
+    // Entities whose timers of this event are due, in due order. Fired timers are forgotten.
+    std::vector<Entity> TakeDue(ETimerEvent event);
+
+    void Save(DataSaver& saver) const override;
+    void Load(DataLoader& loader) override;
+
+private:
+    struct Timer
+    {
+        int dueTick;
+        Entity entity;
+        ETimerEvent event;
+        int generation;
+        bool scheduled;
+    };
+
+    void Insert(TimerHandle handle);
+    void Cascade(std::vector<TimerHandle>& slot);
+    void Free(int index);
+
+    int m_nextTick = 0;
+    std::vector<Timer> m_timers;
+    std::vector<int> m_freeIndices;
+    std::vector<std::vector<TimerHandle>> m_tickSlots;
+    std::vector<std::vector<TimerHandle>> m_minuteSlots;
+    std::vector<std::vector<TimerHandle>> m_hourSlots;
+    std::vector<TimerHandle> m_overflow;
+    std::vector<TimerHandle> m_due;
+};
@@ -0,0 +1,155 @@
+#include "VisibleEntities.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "hatcher/ComponentRegisterer.hpp"
+
+void VisibleEntities::SetFrustum(const glm::mat4& projectionView)
+{
+    // Planes from the rows of the matrix, pointing inside the frustum.
+    const glm::mat4 rows = glm::transpose(projectionView);
+    for (int axis = 0; axis < 3; axis++)
+    {
+        m_planes[axis * 2] = rows[3] + rows[axis];
+        m_planes[axis * 2 + 1] = rows[3] - rows[axis];
+    }
+    m_inverseProjectionView = glm::inverse(projectionView);
+}
+
+bool VisibleEntities::IsVisible(const Box3f& worldBox) const
+{
+    const glm::vec3 min = worldBox.Min();
+    const glm::vec3 max = worldBox.Max();
+    for (const glm::vec4& plane : m_planes)
+    {
+        // The corner furthest along the plane normal is enough to tell the box is wholly outside.
+        const glm::vec3 corner(plane.x > 0.f ? max.x : min.x, plane.y > 0.f ? max.y : min.y,
+                               plane.z > 0.f ? max.z : min.z);
+        if (glm::dot(glm::vec3(plane), corner) + plane.w < 0.f)
+            return false;
+    }
+    return true;
+}
+
+bool VisibleEntities::IsInside(const Box3f& worldBox) const
+{
+    const glm::vec3 min = worldBox.Min();
+    const glm::vec3 max = worldBox.Max();
+    for (const glm::vec4& plane : m_planes)
+    {
+        // The corner nearest along the plane normal tells the box is wholly inside.
+        const glm::vec3 corner(plane.x > 0.f ? min.x : max.x, plane.y > 0.f ? min.y : max.y,
+                               plane.z > 0.f ? min.z : max.z);
+        if (glm::dot(glm::vec3(plane), corner) + plane.w < 0.f)
+            return false;
+    }
+    return true;
+}
+
+Box2f VisibleEntities::Footprint(float minHeight, float maxHeight) const
+{
+    glm::vec2 footprintMin(std::numeric_limits<float>::max());
+    glm::vec2 footprintMax(std::numeric_limits<float>::lowest());
+    const auto AddPoint = [&footprintMin, &footprintMax](glm::vec3 point)
+    {
+        footprintMin = glm::min(footprintMin, glm::vec2(point));
+        footprintMax = glm::max(footprintMax, glm::vec2(point));
+    };
+
+    // Each frustum edge from the near to the far plane is clipped to the slab between both heights.
+    for (float x : {-1.f, 1.f})
+    {
+        for (float y : {-1.f, 1.f})
+        {
+            const glm::vec4 nearCorner = m_inverseProjectionView * glm::vec4(x, y, -1.f, 1.f);
+            const glm::vec4 farCorner = m_inverseProjectionView * glm::vec4(x, y, 1.f, 1.f);
+            const glm::vec3 start = glm::vec3(nearCorner) / nearCorner.w;
+            const glm::vec3 end = glm::vec3(farCorner) / farCorner.w;
+            const glm::vec3 direction = end - start;
+
+            float tMin = 0.f;
+            float tMax = 1.f;
+            if (std::abs(direction.z) > 1e-6f)
+            {
+                const float tLow = (minHeight - start.z) / direction.z;
+                const float tHigh = (maxHeight - start.z) / direction.z;
+                tMin = std::max(tMin, std::min(tLow, tHigh));
+                tMax = std::min(tMax, std::max(tLow, tHigh));
+            }
+            else if (start.z < minHeight || start.z > maxHeight)
+            {
+                continue;
+            }
+            if (tMin > tMax)
+                continue;
+            AddPoint(start + direction * tMin);
+            AddPoint(start + direction * tMax);
+        }
+    }
+    if (footprintMin.x > footprintMax.x)
+        return Box2f(glm::vec2(0.f), glm::vec2(-1.f));
+    return Box2f(footprintMin, footprintMax);
+}
+
+void VisibleEntities::AddStaticEntity(Entity entity, glm::vec2 position, const Box3f& worldBounds)
+{
+    const glm::ivec2 cell = CellOf(position);
+    if (m_cells.empty())
+    {
+        m_cellMin = cell;
+        m_cellMax = cell;
+    }
+    m_cellMin = glm::min(m_cellMin, cell);
+    m_cellMax = glm::max(m_cellMax, cell);
+    StaticCell& staticCell = m_cells[CellKey(cell)];
+    if (staticCell.entries.empty())
+        staticCell.bounds = worldBounds;
+    staticCell.bounds = Box3f(glm::min(staticCell.bounds.Min(), worldBounds.Min()),
+                              glm::max(staticCell.bounds.Max(), worldBounds.Max()));
+    staticCell.entries.push_back({entity, position});
+    staticCell.revision += 1;
+    m_staticRevision += 1;
+}
+
+void VisibleEntities::ClearStaticEntities()
+{
+    // Revisions keep counting, so that nothing built from a previous cell is taken as up to date.
+    for (auto& [key, cell] : m_cells)
+    {
+        cell.entries.clear();
+        cell.revision += 1;
+    }
+    m_staticRevision += 1;
+    m_visibleCells.clear();
+    m_visitedStaticCount = 0;
+    m_staticRebuildNeeded = false;
+}
+
+void VisibleEntities::SetEntities(std::vector<Entity> entities, std::vector<Entity> movingEntities, int culledCount)
+{
+    m_entities = std::move(entities);
+    m_movingEntities = std::move(movingEntities);
+    m_culledCount = culledCount;
+}
+
+void VisibleEntities::Load(DataLoader& loader)
+{
+    m_staticRebuildNeeded = true;
+}
+
+glm::ivec2 VisibleEntities::CellOf(glm::vec2 position) const
+{
+    return glm::ivec2(glm::floor(position / cellSize));
+}
+
+int64_t VisibleEntities::CellKey(glm::ivec2 cell)
+{
+    return (static_cast<int64_t>(cell.x) << 32) | static_cast<uint32_t>(cell.y);
+}
+
+namespace
+{
+WorldComponentTypeRegisterer<VisibleEntities, EComponentList::Rendering> registerer;
+} // namespace
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "hatcher/Entity.hpp"
+#include "hatcher/IWorldComponent.hpp"
+#include "hatcher/Maths/Box.hpp"
+#include "hatcher/Maths/glm_pure.hpp"
+
+using namespace hatcher;
+
+// Entities the camera can see this frame, found by the culling render updater for the scene render updaters.
+// Entities that never move are kept in a grid of cells, so that only the cells under the camera are tested.
+// A cell wholly in or out of the frustum is taken at once, unless its entries may have been deleted since last checked.
+class VisibleEntities final : public IWorldComponent
+{
+public:
+    struct StaticEntry
+    {
+        Entity entity;
+        glm::vec2 position;
+    };
+
+    enum class EStaticVisit
+    {
+        Culled,
+        Visible,
+        Forget,
+    };
+
+    struct StaticCell
+    {
+        std::vector<StaticEntry> entries;
+        // Changed whenever an entry is added or forgotten, so that what was built from the cell can be cached.
+        int revision = 0;
+        // Around the world bounds of every entry. Forgotten entries are only left out once the cell was emptied.
+        Box3f bounds;
+        int checkedGeneration = -1;
+    };
+
+    VisibleEntities(int64_t seed) {}
+
+    void SetFrustum(const glm::mat4& projectionView);
+    bool IsVisible(const Box3f& worldBox) const;
+    bool IsInside(const Box3f& worldBox) const;
+    // Ground area seen by the frustum between these heights.
+    Box2f Footprint(float minHeight, float maxHeight) const;
+
+    void AddStaticEntity(Entity entity, glm::vec2 position, const Box3f& worldBounds);
+    // Static entities may have been deleted, or their id given to a new entity: every entry must be visited again.
+    void InvalidateStaticEntries() { m_generation += 1; }
+    // After a load, until the grid is filled again from the loaded entities.
+    bool StaticRebuildNeeded() const { return m_staticRebuildNeeded; }
+    void ClearStaticEntities();
+    // Visits the static entries of the cells touching area, or gives addCell the cells wholly visible and already
+    // checked. Cells with a visible entry are listed as visible.
+    template <class Visit, class AddCell>
+    void VisitStaticEntities(const Box2f& area, Visit visit, AddCell addCell);
+    // Entries left in the cells of the last visit. Cells never visited may still hold deleted entities.
+    int VisitedStaticCount() const { return m_visitedStaticCount; }
+    const std::vector<int64_t>& VisibleCells() const { return m_visibleCells; }
+    const StaticCell& Cell(int64_t key) const { return m_cells.at(key); }
+    // Changed along with the revision of any cell.
+    int StaticRevision() const { return m_staticRevision; }
+
+    // Both in id order. Moving entities are the ones kept out of the static grid.
+    const std::vector<Entity>& Entities() const { return m_entities; }
+    const std::vector<Entity>& MovingEntities() const { return m_movingEntities; }
+    void SetEntities(std::vector<Entity> entities, std::vector<Entity> movingEntities, int culledCount);
+    int CulledCount() const { return m_culledCount; }
+
+    // Not saved: the grid is filled again from the loaded entities, and the rest is found again every frame.
+    void Save(DataSaver& saver) const override {}
+    void Load(DataLoader& loader) override;
+
+private:
+    static constexpr float cellSize = 8.f;
+
+    glm::ivec2 CellOf(glm::vec2 position) const;
+    static int64_t CellKey(glm::ivec2 cell);
+
+    glm::mat4 m_inverseProjectionView = glm::mat4(1.f);
+    glm::vec4 m_planes[6];
+
+    std::unordered_map<int64_t, StaticCell> m_cells;
+    glm::ivec2 m_cellMin = glm::ivec2(0);
+    glm::ivec2 m_cellMax = glm::ivec2(-1);
+    bool m_staticRebuildNeeded = false;
+    int m_generation = 0;
+    int m_staticRevision = 0;
+    int m_visitedStaticCount = 0;
+    std::vector<int64_t> m_visibleCells;
+
+    std::vector<Entity> m_entities;
+    std::vector<Entity> m_movingEntities;
+    int m_culledCount = 0;
+};
+
+template <class Visit, class AddCell>
+void VisibleEntities::VisitStaticEntities(const Box2f& area, Visit visit, AddCell addCell)
+{
+    m_visibleCells.clear();
+    m_visitedStaticCount = 0;
+    const glm::ivec2 cellMin = glm::max(CellOf(area.Min()), m_cellMin);
+    const glm::ivec2 cellMax = glm::min(CellOf(area.Max()), m_cellMax);
+    for (int y = cellMin.y; y <= cellMax.y; y++)
+    {
+        for (int x = cellMin.x; x <= cellMax.x; x++)
+        {
+            const int64_t key = CellKey({x, y});
+            const auto it = m_cells.find(key);
+            if (it == m_cells.end() || it->second.entries.empty())
+                continue;
+            StaticCell& cell = it->second;
+            if (cell.checkedGeneration == m_generation)
+            {
+                const bool culled = !IsVisible(cell.bounds);
+                if (culled || IsInside(cell.bounds))
+                {
+                    m_visitedStaticCount += static_cast<int>(cell.entries.size());
+                    if (!culled)
+                    {
+                        addCell(cell);
+                        m_visibleCells.push_back(key);
+                    }
+                    continue;
+                }
+            }
+
+            bool visible = false;
+            for (std::size_t i = 0; i < cell.entries.size();)
+            {
+                const EStaticVisit result = visit(cell.entries[i]);
+                if (result == EStaticVisit::Forget)
+                {
+                    cell.entries[i] = cell.entries.back();
+                    cell.entries.pop_back();
+                    cell.revision += 1;
+                    m_staticRevision += 1;
+                }
+                else
+                {
+                    visible = visible || result == EStaticVisit::Visible;
+                    i++;
+                }
+            }
+            cell.checkedGeneration = m_generation;
+            m_visitedStaticCount += static_cast<int>(cell.entries.size());
+            if (visible)
+                m_visibleCells.push_back(key);
+        }
+    }
+}
@@ -0,0 +1,24 @@
+#include "WorldClock.hpp"
+
+#include "hatcher/ComponentRegisterer.hpp"
+#include "hatcher/DataLoader.hpp"
+#include "hatcher/DataSaver.hpp"
+
+#include "utils/SaveFormat.hpp"
+
+void WorldClock::Save(DataSaver& saver) const
+{
+    SaveFormat::WriteVersion(saver);
+    saver << tick;
+}
+
+void WorldClock::Load(DataLoader& loader)
+{
+    SaveFormat::CheckVersion(loader);
+    loader >> tick;
+}
+
+namespace
+{
+WorldComponentTypeRegisterer<WorldClock, EComponentList::Gameplay> registerer;
+} // namespace
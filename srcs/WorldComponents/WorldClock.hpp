@@ -0,0 +1,16 @@
+#pragma once
+
+#include "hatcher/IWorldComponent.hpp"
+
+using namespace hatcher;
+
+// Gameplay ticks elapsed since the world creation, readable from updaters as well as from the rendering side.
+struct WorldClock final : public IWorldComponent
+{
+    int tick{};
+
+    WorldClock(int64_t seed) {}
+
+    void Save(DataSaver& saver) const override;
+    void Load(DataLoader& loader) override;
+};
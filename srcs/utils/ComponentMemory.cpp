@@ -0,0 +1,42 @@
+#include "ComponentMemory.hpp"
+
+namespace
+{
+
+std::vector<ComponentMemoryType>& ComponentMemoryTypes()
+{
+    static std::vector<ComponentMemoryType> types;
+    return types;
+}
+
+} // namespace
+
+void RegisterComponentMemory(const ComponentMemoryType& type)
+{
+    ComponentMemoryTypes().push_back(type);
+}
+
+std::vector<ComponentMemoryUsage> ComponentMemoryUsages(EComponentList componentList,
+                                                        const ComponentAccessor* componentAccessor)
+{
+    std::vector<ComponentMemoryUsage> usages;
+    const int slotCount = componentAccessor->Count();
+    for (const ComponentMemoryType& type : ComponentMemoryTypes())
+    {
+        if (type.componentList != componentList)
+            continue;
+
+        const int count = type.countComponents(componentAccessor);
+        // A sparse set keeps an index per entity, and its packed components with their owners.
+        const std::size_t sparseSetBytes =
+            slotCount * sizeof(int) + count * (type.componentSize + sizeof(Entity));
+        usages.push_back({
+            .name = type.name,
+            .count = count,
+            .slotCount = slotCount,
+            .denseBytes = slotCount * type.slotSize,
+            .sparseSetBytes = sparseSetBytes,
+        });
+    }
+    return usages;
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "hatcher/ComponentAccessor.hpp"
+#include "hatcher/ComponentRegisterer.hpp"
+
+using namespace hatcher;
+
+// Storage the report recommends for a component type. Only a recommendation: storage is chosen by hatcher, where
+// every component type is dense.
+enum class EStorageRecommendation
+{
+    // One slot per entity.
+    Dense,
+    // Packed components with an index per entity.
+    SparseSet,
+};
+
+using CountComponentsFunction = int (*)(const ComponentAccessor* componentAccessor);
+
+// What a component type costs per slot and per component.
+struct ComponentMemoryType
+{
+    const char* name;
+    EComponentList componentList;
+    std::size_t slotSize;
+    std::size_t componentSize;
+    CountComponentsFunction countComponents;
+};
+
+struct ComponentMemoryUsage
+{
+    const char* name;
+    int count;
+    int slotCount;
+    std::size_t denseBytes;
+    std::size_t sparseSetBytes;
+
+    EStorageRecommendation Recommendation() const
+    {
+        return sparseSetBytes < denseBytes ? EStorageRecommendation::SparseSet : EStorageRecommendation::Dense;
+    }
+};
+
+void RegisterComponentMemory(const ComponentMemoryType& type);
+
+std::vector<ComponentMemoryUsage> ComponentMemoryUsages(EComponentList componentList,
+                                                        const ComponentAccessor* componentAccessor);
+
+template <class Component>
+int CountComponents(const ComponentAccessor* componentAccessor)
+{
+    const auto components = componentAccessor->ReadComponents<Component>();
+    int count = 0;
+    for (int i = 0; i < componentAccessor->Count(); i++)
+        count += components[i].has_value();
+    return count;
+}
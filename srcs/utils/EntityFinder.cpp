@@ -6,17 +6,16 @@
 
 #include "hatcher/ComponentAccessor.hpp"
 
-// TODO find better than this O(n^2) !
 Entity FindNearestEntity(const ComponentAccessor* componentAccessor, Entity sourceEntity,
+                         span<const Entity> candidates,
                          std::function<bool(const ComponentAccessor*, Entity entity)> pred)
 {
     const auto& positions = componentAccessor->ReadComponents<PositionComponent>();
     const glm::vec2 source = positions[sourceEntity]->position;
     float minDistanceSq = std::numeric_limits<float>::max();
     Entity result = Entity::Invalid();
-    for (int i = 0; i < componentAccessor->Count(); i++)
+    for (Entity entity : candidates)
     {
-        Entity entity(i);
         if (pred(componentAccessor, entity))
         {
             const glm::vec2 position = positions[entity]->position;
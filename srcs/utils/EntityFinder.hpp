@@ -3,6 +3,7 @@
 #include <functional>
 
 #include "hatcher/Entity.hpp"
+#include "hatcher/span.hpp"
 
 namespace hatcher
 {
@@ -11,5 +12,8 @@ class ComponentAccessor;
 
 using namespace hatcher;
 
+// Nearest of the candidates matching pred, the lowest in candidate order on ties.
+// Candidates are meant to come from the GameplayComponentIndex, so that the search costs their count only.
 Entity FindNearestEntity(const ComponentAccessor* componentAccessor, Entity sourceEntity,
+                         span<const Entity> candidates,
                          std::function<bool(const ComponentAccessor*, Entity entity)> pred);
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <optional>
+
+#include "hatcher/ComponentAccessor.hpp"
+#include "hatcher/ComponentRegisterer.hpp"
+
+#include "WorldComponents/ComponentIndex.hpp"
+#include "utils/ComponentMemory.hpp"
+
+using namespace hatcher;
+
+// Registers a component type to the engine, its memory usage, and its presence check if it is listed as indexed.
+template <class Component, EComponentList ComponentList>
+class GameComponentRegisterer
+{
+public:
+    GameComponentRegisterer(const char* name)
+    {
+        RegisterComponentMemory({
+            .name = name,
+            .componentList = ComponentList,
+            .slotSize = sizeof(std::optional<Component>),
+            .componentSize = sizeof(Component),
+            .countComponents = CountComponents<Component>,
+        });
+
+        if constexpr (isIndexedComponent<Component>)
+        {
+            static_assert(IndexedComponentSlot<Component>::componentList == ComponentList);
+            RegisterIndexedComponent(ComponentList, IndexedComponentSlot<Component>::slot,
+                                     [](const ComponentAccessor* componentAccessor, Entity entity)
+                                     { return componentAccessor->ReadComponents<Component>()[entity].has_value(); });
+        }
+    }
+
+private:
+    ComponentTypeRegisterer<Component, ComponentList> m_typeRegisterer;
+};
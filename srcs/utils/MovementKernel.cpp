@@ -0,0 +1,71 @@
+#include "MovementKernel.hpp"
+
+#include <cmath>
+
+namespace
+{
+// float(0.001) is above 0.001, so this is exactly MoveAlongPath's double comparison.
+constexpr float MIN_TURNING_DISTANCE = 0.001f;
+} // namespace
+
+void MoverBlock::StepTowardWaypoints(float step)
+{
+    float movedX[MOVER_BLOCK_SIZE];
+    float movedY[MOVER_BLOCK_SIZE];
+    float moved[MOVER_BLOCK_SIZE];
+    // Same operations in the same order as glm::length and glm::normalize, so that results are bit-identical.
+    for (int i = 0; i < MOVER_BLOCK_SIZE; i++)
+    {
+        const float directionX = m_waypointX[i] - m_positionX[i];
+        const float directionY = m_waypointY[i] - m_positionY[i];
+        const float distance = std::sqrt(directionX * directionX + directionY * directionY);
+        const float inverseLength = 1.f / distance;
+        const float newX = m_positionX[i] + directionX * inverseLength * step;
+        const float newY = m_positionY[i] + directionY * inverseLength * step;
+        movedX[i] = newX - m_positionX[i];
+        movedY[i] = newY - m_positionY[i];
+        moved[i] = std::sqrt(movedX[i] * movedX[i] + movedY[i] * movedY[i]);
+        m_reachesWaypoint[i] = distance <= step;
+        m_positionX[i] = newX;
+        m_positionY[i] = newY;
+    }
+    // One select per loop, dividing unconditionally, or the compiler branches around the divisions.
+    for (int i = 0; i < MOVER_BLOCK_SIZE; i++)
+    {
+        const float turnedX = movedX[i] / moved[i];
+        m_orientationX[i] = moved[i] >= MIN_TURNING_DISTANCE ? turnedX : m_orientationX[i];
+    }
+    for (int i = 0; i < MOVER_BLOCK_SIZE; i++)
+    {
+        const float turnedY = movedY[i] / moved[i];
+        m_orientationY[i] = moved[i] >= MIN_TURNING_DISTANCE ? turnedY : m_orientationY[i];
+    }
+}
+
+int MoveAlongPath(PositionComponent& position2D, span<const glm::vec2> path, float step)
+{
+    int remainingWaypoints = static_cast<int>(path.size());
+    float movementLength = step;
+    const glm::vec2 startPosition = position2D.position;
+    while (remainingWaypoints > 0 && movementLength > 0.f)
+    {
+        glm::vec2 nextObjective = path[remainingWaypoints - 1];
+        const glm::vec2 direction = (nextObjective - position2D.position);
+        const float distanceToNextObjective = glm::length(direction);
+        if (distanceToNextObjective <= movementLength)
+        {
+            position2D.position = nextObjective;
+            remainingWaypoints -= 1;
+            movementLength -= distanceToNextObjective;
+        }
+        else
+        {
+            position2D.position += glm::normalize(direction) * movementLength;
+            movementLength = 0.f;
+        }
+    }
+    const float distance = glm::length(position2D.position - startPosition);
+    if (distance > 0.001) // micro-steps give an absurd orientation because of floating precision.
+        position2D.orientation = (position2D.position - startPosition) / distance;
+    return remainingWaypoints;
+}
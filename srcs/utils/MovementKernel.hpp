@@ -0,0 +1,57 @@
+#pragma once
+
+#include "hatcher/Maths/glm_pure.hpp"
+#include "hatcher/span.hpp"
+
+#include "Components/PositionComponent.hpp"
+
+using namespace hatcher;
+
+// Movers stepped together: 16 floats fill one AVX-512 register, two AVX ones, or four SSE or WebAssembly ones.
+constexpr int MOVER_BLOCK_SIZE = 16;
+
+// Positions, orientations and next waypoints of up to MOVER_BLOCK_SIZE movers, one array per coordinate so that
+// stepping them vectorizes.
+class MoverBlock
+{
+public:
+    int Count() const { return m_count; }
+    bool IsFull() const { return m_count == MOVER_BLOCK_SIZE; }
+    void Clear() { m_count = 0; }
+    void Add(const PositionComponent& position2D, glm::vec2 waypoint)
+    {
+        m_positionX[m_count] = position2D.position.x;
+        m_positionY[m_count] = position2D.position.y;
+        m_orientationX[m_count] = position2D.orientation.x;
+        m_orientationY[m_count] = position2D.orientation.y;
+        m_waypointX[m_count] = waypoint.x;
+        m_waypointY[m_count] = waypoint.y;
+        m_count++;
+    }
+
+    // Moves every mover by step toward its waypoint, giving the same floats as MoveAlongPath.
+    // Movers reaching their waypoint are only flagged: they need MoveAlongPath to follow the rest of their path.
+    void StepTowardWaypoints(float step);
+
+    bool ReachesWaypoint(int index) const { return m_reachesWaypoint[index]; }
+    void Get(int index, PositionComponent& position2D) const
+    {
+        position2D.position = {m_positionX[index], m_positionY[index]};
+        position2D.orientation = {m_orientationX[index], m_orientationY[index]};
+    }
+
+private:
+    // Lanes past the count are stepped too, on whatever they hold, to keep the loops at a fixed length.
+    float m_positionX[MOVER_BLOCK_SIZE] = {};
+    float m_positionY[MOVER_BLOCK_SIZE] = {};
+    float m_orientationX[MOVER_BLOCK_SIZE] = {};
+    float m_orientationY[MOVER_BLOCK_SIZE] = {};
+    float m_waypointX[MOVER_BLOCK_SIZE] = {};
+    float m_waypointY[MOVER_BLOCK_SIZE] = {};
+    int m_reachesWaypoint[MOVER_BLOCK_SIZE] = {};
+    int m_count = 0;
+};
+
+// Scalar version, following the reversed path through as many waypoints as the step allows.
+// Returns how many waypoints remain.
+int MoveAlongPath(PositionComponent& position2D, span<const glm::vec2> path, float step);
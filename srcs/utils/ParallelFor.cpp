@@ -0,0 +1,31 @@
+#include "ParallelFor.hpp"
+
+#include <algorithm>
+
+int ParallelChunkCount(int count)
+{
+    return (count + PARALLEL_CHUNK_SIZE - 1) / PARALLEL_CHUNK_SIZE;
+}
+
+void ParallelForChunks(int count, const std::function<void(int chunkIndex, int begin, int end)>& function,
+                       ThreadPool& threadPool)
+{
+    const int chunkCount = ParallelChunkCount(count);
+    const auto RunChunk = [&function, count](int chunkIndex)
+    {
+        const int begin = chunkIndex * PARALLEL_CHUNK_SIZE;
+        function(chunkIndex, begin, std::min(count, begin + PARALLEL_CHUNK_SIZE));
+    };
+
+    if (chunkCount <= 1 || threadPool.ThreadCount() == 1)
+    {
+        for (int chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++)
+            RunChunk(chunkIndex);
+        return;
+    }
+
+    ThreadPool::TaskGroup group;
+    for (int chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++)
+        threadPool.Submit(group, [&RunChunk, chunkIndex]() { RunChunk(chunkIndex); });
+    threadPool.Wait(group);
+}
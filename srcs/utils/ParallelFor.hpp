@@ -0,0 +1,138 @@
+#pragma once
+
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "hatcher/ComponentAccessor.hpp"
+#include "hatcher/span.hpp"
+
+#include "ThreadPool.hpp"
+
+using namespace hatcher;
+
+// Ranges are cut in fixed-size chunks, whatever the thread count, so per-chunk results combined in chunk order
+// give the same result on every machine.
+constexpr int PARALLEL_CHUNK_SIZE = 256;
+
+int ParallelChunkCount(int count);
+
+// Calls function(chunkIndex, begin, end) for every chunk of [0, count[, on the thread pool.
+void ParallelForChunks(int count, const std::function<void(int chunkIndex, int begin, int end)>& function,
+                       ThreadPool& threadPool = GetThreadPool());
+
+template <class Function>
+void ParallelFor(int count, const Function& function, ThreadPool& threadPool = GetThreadPool())
+{
+    const auto RunChunk = [&function](int chunkIndex, int begin, int end)
+    {
+        for (int i = begin; i < end; i++)
+            function(i);
+    };
+    ParallelForChunks(count, RunChunk, threadPool);
+}
+
+namespace ParallelForEachDetails
+{
+template <class Component>
+auto ComponentArray(ComponentAccessor* componentAccessor)
+{
+    if constexpr (std::is_const_v<Component>)
+        return componentAccessor->ReadComponents<std::remove_const_t<Component>>();
+    else
+        return componentAccessor->WriteComponents<Component>();
+}
+} // namespace ParallelForEachDetails
+
+// Calls function(entity, components...) for every given entity owning all the given components.
+// Const components are only read, the others are written: the function must only touch its own entity's.
+template <class... Components, class Function>
+void ParallelForEach(span<const Entity> entities, ComponentAccessor* componentAccessor, const Function& function,
+                     ThreadPool& threadPool = GetThreadPool())
+{
+    auto componentArrays = std::make_tuple(ParallelForEachDetails::ComponentArray<Components>(componentAccessor)...);
+    const auto RunEntity = [&componentArrays, &function, entities](int index)
+    {
+        const Entity entity = entities[index];
+        const auto RunIfComplete = [&function, entity](auto&... components)
+        {
+            if ((components[entity] && ...))
+                function(entity, *components[entity]...);
+        };
+        std::apply(RunIfComplete, componentArrays);
+    };
+    ParallelFor(static_cast<int>(entities.size()), RunEntity, threadPool);
+}
+
+// Calls function(i, accumulator) for every index, then combines the per-chunk accumulators in chunk order.
+template <class T, class Function, class Combine>
+T ParallelReduce(int count, const T& identity, const Function& function, const Combine& combine,
+                 ThreadPool& threadPool = GetThreadPool())
+{
+    std::vector<T> chunkResults(ParallelChunkCount(count), identity);
+    const auto ReduceChunk = [&chunkResults, &function](int chunkIndex, int begin, int end)
+    {
+        for (int i = begin; i < end; i++)
+            function(i, chunkResults[chunkIndex]);
+    };
+    ParallelForChunks(count, ReduceChunk, threadPool);
+    T result = identity;
+    for (const T& chunkResult : chunkResults)
+        combine(result, chunkResult);
+    return result;
+}
+
+// Calls function(begin, end, output) for every chunk, and returns the outputs in chunk order.
+template <class T, class Function>
+std::vector<T> ParallelCollectChunks(int count, const Function& function, ThreadPool& threadPool = GetThreadPool())
+{
+    std::vector<std::vector<T>> chunkOutputs(ParallelChunkCount(count));
+    const auto CollectChunk = [&chunkOutputs, &function](int chunkIndex, int begin, int end)
+    { function(begin, end, chunkOutputs[chunkIndex]); };
+    ParallelForChunks(count, CollectChunk, threadPool);
+    std::vector<T> result;
+    for (std::vector<T>& chunkOutput : chunkOutputs)
+        result.insert(result.end(), chunkOutput.begin(), chunkOutput.end());
+    return result;
+}
+
+// Calls function(i, output) for every index, and returns the outputs in the order a serial loop would.
+template <class T, class Function>
+std::vector<T> ParallelCollect(int count, const Function& function, ThreadPool& threadPool = GetThreadPool())
+{
+    const auto CollectChunk = [&function](int begin, int end, std::vector<T>& output)
+    {
+        for (int i = begin; i < end; i++)
+            function(i, output);
+    };
+    return ParallelCollectChunks<T>(count, CollectChunk, threadPool);
+}
+
+// One T per pool thread, to keep scratch buffers without locking.
+template <class T>
+class PerThread
+{
+public:
+    PerThread()
+        : m_slots(GetThreadPool().ThreadCount())
+    {
+    }
+
+    T& Local() { return m_slots[ThreadPool::CurrentThreadIndex()].value; }
+
+    template <class Function>
+    void ForEach(const Function& function)
+    {
+        for (Slot& slot : m_slots)
+            function(slot.value);
+    }
+
+private:
+    struct alignas(64) Slot
+    {
+        T value;
+    };
+
+    std::vector<Slot> m_slots;
+};
@@ -1,8 +1,11 @@
 #include "Pathfinding.hpp"
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <set>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "hatcher/assert.hpp"
 
@@ -35,6 +38,15 @@ struct NodeValueSorter
     };
 };
 using NodeSet = std::multiset<const Pathfinding::Node*, NodeValueSorter>;
+
+// Nodes are matched on exact positions, so their bits make a fine key.
+std::uint64_t PositionKey(glm::vec2 position)
+{
+    std::uint32_t x, y;
+    std::memcpy(&x, &position.x, sizeof(x));
+    std::memcpy(&y, &position.y, sizeof(y));
+    return (static_cast<std::uint64_t>(x) << 32) | y;
+}
 } // namespace
 
 bool Pathfinding::ContainsNode(glm::vec2 position) const
@@ -71,6 +83,59 @@ void Pathfinding::DeleteNode(glm::vec2 position)
     m_nodes.erase(it);
 }
 
+void Pathfinding::CreateNodes(const std::vector<glm::vec2>& positions)
+{
+    m_nodes.reserve(m_nodes.size() + positions.size());
+    for (glm::vec2 position : positions)
+        CreateNode(position);
+}
+
+void Pathfinding::LinkNodes(const std::vector<std::pair<glm::vec2, glm::vec2>>& links)
+{
+    std::unordered_map<std::uint64_t, Node*> nodesByPosition;
+    nodesByPosition.reserve(m_nodes.size());
+    for (const unique_ptr<Node>& node : m_nodes)
+        nodesByPosition.emplace(PositionKey(node->pos), node.get());
+
+    for (const auto& [positionA, positionB] : links)
+    {
+        const auto itA = nodesByPosition.find(PositionKey(positionA));
+        const auto itB = nodesByPosition.find(PositionKey(positionB));
+        HATCHER_ASSERT(itA != nodesByPosition.end());
+        HATCHER_ASSERT(itB != nodesByPosition.end());
+        Node* nodeA = itA->second;
+        Node* nodeB = itB->second;
+        HATCHER_ASSERT(std::find(nodeA->links.begin(), nodeA->links.end(), nodeB) == nodeA->links.end());
+        nodeA->links.emplace_back(nodeB);
+    }
+}
+
+void Pathfinding::DeleteNodes(const std::vector<glm::vec2>& positions)
+{
+    std::unordered_set<std::uint64_t> deletedPositions;
+    for (glm::vec2 position : positions)
+        deletedPositions.insert(PositionKey(position));
+
+    const auto IsDeleted = [&deletedPositions](const Node* node)
+    {
+        return deletedPositions.count(PositionKey(node->pos)) != 0;
+    };
+    for (const unique_ptr<Node>& node : m_nodes)
+    {
+        if (IsDeleted(node.get()))
+        {
+            for (Node* neighbour : node->links)
+            {
+                if (!IsDeleted(neighbour))
+                    neighbour->links.erase(std::find(neighbour->links.begin(), neighbour->links.end(), node.get()));
+            }
+        }
+    }
+
+    const auto NodeIsDeleted = [&IsDeleted](const unique_ptr<Node>& node) { return IsDeleted(node.get()); };
+    m_nodes.erase(std::remove_if(m_nodes.begin(), m_nodes.end(), NodeIsDeleted), m_nodes.end());
+}
+
 std::vector<glm::vec2> Pathfinding::GetPath(glm::vec2 startPos, glm::vec2 endPos, float distance) const
 {
     const Node* startNode = FindNodeByPosition(startPos);
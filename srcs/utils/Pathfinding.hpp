@@ -1,5 +1,6 @@
 #pragma once
 
+#include <utility>
 #include <vector>
 
 #include "hatcher/Maths/glm_pure.hpp"
@@ -16,6 +17,11 @@ public:
     void LinkNodes(glm::vec2 positionA, glm::vec2 positionB);
     void DeleteNode(glm::vec2 position);
 
+    // Batched versions, finding every node in a single pass instead of one per position.
+    void CreateNodes(const std::vector<glm::vec2>& positions);
+    void LinkNodes(const std::vector<std::pair<glm::vec2, glm::vec2>>& links);
+    void DeleteNodes(const std::vector<glm::vec2>& positions);
+
     std::vector<glm::vec2> GetPath(glm::vec2 startPos, glm::vec2 endPos, float distance) const;
 
     struct Node
@@ -0,0 +1,46 @@
+#include "SaveFormat.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include "hatcher/DataLoader.hpp"
+#include "hatcher/DataSaver.hpp"
+
+namespace SaveFormat
+{
+
+namespace
+{
+// Its bits read as a NaN float, and as an impossible size or enum value, so that a record saved before versions
+// existed is told apart by its first four bytes.
+constexpr std::uint32_t markerBits = 0x7FC00000;
+constexpr std::uint32_t versionMask = 0x0000FFFF;
+
+// 0 if the record was saved before versions existed.
+int Version(std::uint32_t head)
+{
+    return (head & ~versionMask) == markerBits ? static_cast<int>(head & versionMask) : 0;
+}
+} // namespace
+
+void WriteVersion(hatcher::DataSaver& saver)
+{
+    saver << (markerBits | static_cast<std::uint32_t>(version));
+}
+
+void CheckVersion(hatcher::DataLoader& loader)
+{
+    std::uint32_t head;
+    loader >> head;
+    const int headVersion = Version(head);
+    if (headVersion != version)
+    {
+        const std::string saveVersion =
+            headVersion == 0 ? "an older version" : "version " + std::to_string(headVersion);
+        throw std::runtime_error("cannot load a save of " + saveVersion + ", expected version " +
+                                 std::to_string(version));
+    }
+}
+
+} // namespace SaveFormat
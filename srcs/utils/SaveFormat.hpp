@@ -0,0 +1,23 @@
+#pragma once
+
+namespace hatcher
+{
+class DataLoader;
+class DataSaver;
+} // namespace hatcher
+
+// Every record whose layout changed since the first saves, or that did not exist in them, leads with the version of
+// the save it was written in.
+namespace SaveFormat
+{
+
+// Version of the whole save, bumped whenever a record layout changes or a world component is added.
+// 1: first versioned save.
+constexpr int version = 1;
+
+// Saves of other versions cannot be loaded: the first versioned record read from one throws, rather than anything
+// being read out of place.
+void WriteVersion(hatcher::DataSaver& saver);
+void CheckVersion(hatcher::DataLoader& loader);
+
+} // namespace SaveFormat
@@ -0,0 +1,72 @@
+#include "ScheduledUpdater.hpp"
+
+#include <algorithm>
+
+namespace
+{
+
+std::vector<GameplayHooksFactory>& HooksFactories()
+{
+    static std::vector<GameplayHooksFactory> factories;
+    return factories;
+}
+
+std::vector<ScheduledUpdaterFactory>& UpdaterFactories()
+{
+    static std::vector<ScheduledUpdaterFactory> factories;
+    return factories;
+}
+
+bool Intersects(const std::vector<std::type_index>& typesA, const std::vector<std::type_index>& typesB)
+{
+    return std::find_first_of(typesA.begin(), typesA.end(), typesB.begin(), typesB.end()) != typesA.end();
+}
+
+} // namespace
+
+ComponentAccess ComponentAccess::Exclusive()
+{
+    ComponentAccess access;
+    access.m_exclusive = true;
+    return access;
+}
+
+bool ComponentAccess::ConflictsWith(const ComponentAccess& other) const
+{
+    return m_exclusive || other.m_exclusive || Intersects(m_writes, other.m_writes) ||
+           Intersects(m_writes, other.m_reads) || Intersects(m_reads, other.m_writes);
+}
+
+void GameplayHooks::OnCreatedEntities(span<const Entity> entities, IEntityManager* entityManager,
+                                      ComponentAccessor* componentAccessor)
+{
+    for (Entity entity : entities)
+        OnCreatedEntity(entity, entityManager, componentAccessor);
+}
+
+void GameplayHooks::OnDeletedEntities(span<const Entity> entities, IEntityManager* entityManager,
+                                      ComponentAccessor* componentAccessor)
+{
+    for (Entity entity : entities)
+        OnDeletedEntity(entity, entityManager, componentAccessor);
+}
+
+void RegisterGameplayHooks(GameplayHooksFactory factory)
+{
+    HooksFactories().push_back(std::move(factory));
+}
+
+const std::vector<GameplayHooksFactory>& GameplayHooksFactories()
+{
+    return HooksFactories();
+}
+
+void RegisterScheduledUpdater(ScheduledUpdaterFactory factory)
+{
+    UpdaterFactories().push_back(std::move(factory));
+}
+
+const std::vector<ScheduledUpdaterFactory>& ScheduledUpdaterFactories()
+{
+    return UpdaterFactories();
+}
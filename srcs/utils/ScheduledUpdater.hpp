@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <typeindex>
+#include <vector>
+
+#include "hatcher/Entity.hpp"
+#include "hatcher/span.hpp"
+#include "hatcher/unique_ptr.hpp"
+
+#include "WorldComponents/IndexedComponents.hpp"
+
+namespace hatcher
+{
+class ComponentAccessor;
+class IEntityManager;
+} // namespace hatcher
+
+using namespace hatcher;
+
+// Components and world components an updater reads or writes during its Update.
+class ComponentAccess
+{
+public:
+    static ComponentAccess Exclusive();
+
+    template <class... Components>
+    ComponentAccess& Reads()
+    {
+        (m_reads.emplace_back(typeid(Components)), ...);
+        return *this;
+    }
+
+    template <class... Components>
+    ComponentAccess& Writes()
+    {
+        (m_writes.emplace_back(typeid(Components)), ...);
+        return *this;
+    }
+
+    bool IsExclusive() const { return m_exclusive; }
+    bool ConflictsWith(const ComponentAccess& other) const;
+
+private:
+    bool m_exclusive = false;
+    std::vector<std::type_index> m_reads;
+    std::vector<std::type_index> m_writes;
+};
+
+// Entities an updater's entity hooks care about: owners of any of the given indexed components, or every entity
+// if none are given.
+class EntityFilter
+{
+public:
+    template <class... Components>
+    static EntityFilter AnyOf()
+    {
+        EntityFilter filter;
+        (filter.m_slots.push_back(IndexedComponentSlot<Components>::slot), ...);
+        return filter;
+    }
+
+    bool AcceptsAll() const { return m_slots.empty(); }
+    const std::vector<int>& Slots() const { return m_slots; }
+
+private:
+    std::vector<int> m_slots;
+};
+
+// Entity and world hooks called by the UpdaterScheduler. Classes with nothing to update every tick derive from this
+// alone, so that they are never scheduled.
+class GameplayHooks
+{
+public:
+    virtual ~GameplayHooks() = default;
+
+    virtual void CreateWorld(int64_t seed, IEntityManager* entityManager, ComponentAccessor* componentAccessor) const {}
+    // Called before the first update following a load, to rebuild what saves do not hold.
+    // Also called once after the world creation.
+    virtual void OnWorldLoaded(IEntityManager* entityManager, ComponentAccessor* componentAccessor) {}
+
+    // Entities filtered out are never given to the hooks below.
+    virtual EntityFilter CreatedEntityFilter() const { return {}; }
+    virtual EntityFilter DeletedEntityFilter() const { return {}; }
+
+    virtual void OnCreatedEntity(Entity entity, IEntityManager* entityManager, ComponentAccessor* componentAccessor) {}
+    virtual void OnDeletedEntity(Entity entity, IEntityManager* entityManager, ComponentAccessor* componentAccessor) {}
+
+    // The scheduler only calls these, once per batch of structural changes. By default, they call the hooks above
+    // for every entity. Deleted entities all still have their components.
+    virtual void OnCreatedEntities(span<const Entity> entities, IEntityManager* entityManager,
+                                   ComponentAccessor* componentAccessor);
+    virtual void OnDeletedEntities(span<const Entity> entities, IEntityManager* entityManager,
+                                   ComponentAccessor* componentAccessor);
+};
+
+// Gameplay updater run by the UpdaterScheduler.
+// Updaters declaring their access can run at the same time as any other updater they do not conflict with,
+// so they must only create or delete entities through the EntityCommandBuffer, declared as written.
+// The others run alone, in registration order.
+class ScheduledUpdater : public GameplayHooks
+{
+public:
+    virtual ComponentAccess Access() const { return ComponentAccess::Exclusive(); }
+
+    virtual void Update(IEntityManager* entityManager, ComponentAccessor* componentAccessor) = 0;
+};
+
+using GameplayHooksFactory = std::function<unique_ptr<GameplayHooks>()>;
+using ScheduledUpdaterFactory = std::function<unique_ptr<ScheduledUpdater>()>;
+
+void RegisterGameplayHooks(GameplayHooksFactory factory);
+const std::vector<GameplayHooksFactory>& GameplayHooksFactories();
+void RegisterScheduledUpdater(ScheduledUpdaterFactory factory);
+const std::vector<ScheduledUpdaterFactory>& ScheduledUpdaterFactories();
+
+template <class HooksClass>
+class GameplayHooksRegisterer
+{
+public:
+    GameplayHooksRegisterer()
+    {
+        RegisterGameplayHooks([]() -> unique_ptr<GameplayHooks> { return make_unique<HooksClass>(); });
+    }
+};
+
+template <class UpdaterClass>
+class ScheduledUpdaterRegisterer
+{
+public:
+    ScheduledUpdaterRegisterer()
+    {
+        RegisterScheduledUpdater([]() -> unique_ptr<ScheduledUpdater> { return make_unique<UpdaterClass>(); });
+    }
+};
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <algorithm>
+#include <deque>
+
+#include "hatcher/assert.hpp"
+
+// A value shared by many entities, typically all those of a descriptor, stored once in a table of its type.
+// Copying it, as spawning does, copies an index. Equal values share the same entry, which Data must compare.
+// Interning is not thread-safe: values are only built by descriptors, on load and from the main thread.
+template <class Data>
+class Shared
+{
+public:
+    Shared() = default;
+    Shared(const Data& data)
+        : m_index(Intern(data))
+    {
+    }
+
+    const Data& operator*() const
+    {
+        HATCHER_ASSERT(m_index >= 0);
+        return Table()[m_index];
+    }
+    const Data* operator->() const { return &**this; }
+
+private:
+    static std::deque<Data>& Table()
+    {
+        // A deque, so that references stay valid while new values are interned.
+        static std::deque<Data> table;
+        return table;
+    }
+
+    static int Intern(const Data& data)
+    {
+        std::deque<Data>& table = Table();
+        const auto it = std::find(table.begin(), table.end(), data);
+        if (it != table.end())
+            return static_cast<int>(it - table.begin());
+        table.push_back(data);
+        return static_cast<int>(table.size()) - 1;
+    }
+
+    int m_index = -1;
+};
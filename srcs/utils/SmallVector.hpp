@@ -0,0 +1,105 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "hatcher/assert.hpp"
+
+// A vector keeping up to InlineCapacity elements inside itself, spilling to the heap only beyond.
+// Elements live inline or on the heap, never both, so that copies need no pointer fix-up.
+template <class T, std::size_t InlineCapacity>
+class SmallVector
+{
+    static_assert(std::is_trivially_copyable_v<T>, "SmallVector only holds plain values.");
+
+public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    T* data() { return IsInline() ? InlineData() : m_heap.data(); }
+    const T* data() const { return IsInline() ? InlineData() : m_heap.data(); }
+
+    T* begin() { return data(); }
+    T* end() { return data() + m_size; }
+    const T* begin() const { return data(); }
+    const T* end() const { return data() + m_size; }
+
+    std::size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    T& operator[](std::size_t index)
+    {
+        HATCHER_ASSERT(index < m_size);
+        return data()[index];
+    }
+    const T& operator[](std::size_t index) const
+    {
+        HATCHER_ASSERT(index < m_size);
+        return data()[index];
+    }
+
+    void push_back(const T& value)
+    {
+        if (m_size < InlineCapacity)
+        {
+            new (InlineData() + m_size) T(value);
+        }
+        else
+        {
+            if (m_size == InlineCapacity)
+                m_heap.assign(InlineData(), InlineData() + InlineCapacity);
+            m_heap.push_back(value);
+        }
+        m_size += 1;
+    }
+
+    T* erase(const T* first, const T* last)
+    {
+        const std::ptrdiff_t index = first - data();
+        const std::ptrdiff_t erasedCount = last - first;
+        std::copy(begin() + index + erasedCount, end(), begin() + index);
+        Shrink(m_size - erasedCount);
+        return begin() + index;
+    }
+    T* erase(const T* position) { return erase(position, position + 1); }
+
+    void clear() { Shrink(0); }
+
+    template <class InputIterator>
+    void assign(InputIterator first, InputIterator last)
+    {
+        clear();
+        for (; first != last; ++first)
+            push_back(*first);
+    }
+
+private:
+    bool IsInline() const { return m_size <= InlineCapacity; }
+    T* InlineData() { return std::launder(reinterpret_cast<T*>(m_inline)); }
+    const T* InlineData() const { return std::launder(reinterpret_cast<const T*>(m_inline)); }
+
+    void Shrink(std::size_t size)
+    {
+        if (!IsInline() && size <= InlineCapacity)
+        {
+            std::uninitialized_copy(m_heap.begin(), m_heap.begin() + size, InlineData());
+            // Capacity is kept, an inventory that spilled once is likely to spill again.
+            m_heap.clear();
+        }
+        else if (!IsInline())
+        {
+            m_heap.erase(m_heap.begin() + size, m_heap.end());
+        }
+        m_size = size;
+    }
+
+    std::size_t m_size = 0;
+    // Raw bytes, as T need not be default constructible.
+    alignas(T) std::byte m_inline[sizeof(T) * InlineCapacity];
+    std::vector<T> m_heap;
+};
@@ -0,0 +1,139 @@
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+
+#include "hatcher/assert.hpp"
+
+namespace
+{
+thread_local int currentThreadIndex = 0;
+} // namespace
+
+ThreadPool::ThreadPool(int workerCount)
+{
+    for (int i = 0; i < workerCount + 1; i++)
+        m_queues.emplace_back(make_unique<TaskQueue>());
+    for (int i = 0; i < workerCount; i++)
+        m_threads.emplace_back(&ThreadPool::WorkerLoop, this, i + 1);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_stopping = true;
+    }
+    m_wakeUp.notify_all();
+    for (std::thread& thread : m_threads)
+        thread.join();
+}
+
+int ThreadPool::CurrentThreadIndex()
+{
+    return currentThreadIndex;
+}
+
+void ThreadPool::Submit(TaskGroup& group, std::function<void()> function)
+{
+    group.m_pendingTasks += 1;
+    TaskQueue& queue = *m_queues[currentThreadIndex];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back({std::move(function), &group});
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_queuedTasks += 1;
+    }
+    m_wakeUp.notify_one();
+}
+
+void ThreadPool::Wait(TaskGroup& group)
+{
+    Task task;
+    while (group.m_pendingTasks > 0)
+    {
+        if (PopOrSteal(currentThreadIndex, task))
+        {
+            Run(task);
+            continue;
+        }
+
+        // The group's last tasks run elsewhere: sleep until they end, or until there is something to help with.
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_wakeUp.wait(lock, [this, &group]() { return group.m_pendingTasks == 0 || m_queuedTasks > 0; });
+    }
+}
+
+bool ThreadPool::PopOrSteal(int threadIndex, Task& task)
+{
+    {
+        TaskQueue& ownQueue = *m_queues[threadIndex];
+        std::lock_guard<std::mutex> lock(ownQueue.mutex);
+        if (!ownQueue.tasks.empty())
+        {
+            task = std::move(ownQueue.tasks.back());
+            ownQueue.tasks.pop_back();
+            m_queuedTasks -= 1;
+            return true;
+        }
+    }
+    const int queueCount = static_cast<int>(m_queues.size());
+    for (int offset = 1; offset < queueCount; offset++)
+    {
+        TaskQueue& victimQueue = *m_queues[(threadIndex + offset) % queueCount];
+        std::lock_guard<std::mutex> lock(victimQueue.mutex);
+        if (!victimQueue.tasks.empty())
+        {
+            task = std::move(victimQueue.tasks.front());
+            victimQueue.tasks.pop_front();
+            m_queuedTasks -= 1;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::Run(Task& task)
+{
+    TaskGroup* group = task.group;
+    task.function();
+    task.function = {};
+    HATCHER_ASSERT(group->m_pendingTasks > 0);
+    if (--group->m_pendingTasks == 0)
+    {
+        // Taking the lock orders the wake up after the waiter's check.
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_wakeUp.notify_all();
+    }
+}
+
+void ThreadPool::WorkerLoop(int threadIndex)
+{
+    currentThreadIndex = threadIndex;
+    Task task;
+    while (true)
+    {
+        if (PopOrSteal(threadIndex, task))
+        {
+            Run(task);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_wakeUp.wait(lock, [this]() { return m_stopping || m_queuedTasks > 0; });
+        if (m_stopping)
+            return;
+    }
+}
+
+ThreadPool& GetThreadPool()
+{
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+    // No threads without pthread support: every task runs on the waiting thread.
+    static ThreadPool threadPool(0);
+#else
+    static ThreadPool threadPool(std::max(static_cast<int>(std::thread::hardware_concurrency()) - 1, 0));
+#endif
+    return threadPool;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "hatcher/unique_ptr.hpp"
+
+using namespace hatcher;
+
+// Work-stealing pool: each thread pushes and pops its own queue, idle threads steal from the others.
+// A thread waiting on a group keeps running tasks, so tasks can submit and wait on nested groups.
+class ThreadPool
+{
+public:
+    class TaskGroup
+    {
+        friend class ThreadPool;
+        std::atomic<int> m_pendingTasks = 0;
+    };
+
+    explicit ThreadPool(int workerCount);
+    ~ThreadPool();
+
+    // Worker threads plus the calling thread, which always takes part in Wait.
+    int ThreadCount() const { return static_cast<int>(m_threads.size()) + 1; }
+    // 0 for any thread outside of the pool, [1, ThreadCount()[ for its workers.
+    static int CurrentThreadIndex();
+
+    void Submit(TaskGroup& group, std::function<void()> function);
+    void Wait(TaskGroup& group);
+
+private:
+    struct Task
+    {
+        std::function<void()> function;
+        TaskGroup* group;
+    };
+
+    struct TaskQueue
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    bool PopOrSteal(int threadIndex, Task& task);
+    void Run(Task& task);
+    void WorkerLoop(int threadIndex);
+
+    std::vector<unique_ptr<TaskQueue>> m_queues;
+    std::vector<std::thread> m_threads;
+
+    std::atomic<int> m_queuedTasks = 0;
+    std::mutex m_sleepMutex;
+    std::condition_variable m_wakeUp;
+    bool m_stopping = false;
+};
+
+ThreadPool& GetThreadPool();
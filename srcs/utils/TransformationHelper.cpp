@@ -7,11 +7,23 @@ namespace TransformationHelper
 
 glm::mat4 ModelFromComponents(const PositionComponent& position2D)
 {
-    const float angle = glm::orientedAngle(glm::vec2(1.f, 0.f), position2D.orientation);
+    // The orientation is a unit vector: it already holds the cosine and sine of the rotation around Z.
+    const glm::vec2 orientation = position2D.orientation;
     glm::mat4 modelMatrix = glm::mat4(1.f);
-    modelMatrix = glm::translate(modelMatrix, glm::vec3(position2D.position, 0.f));
-    modelMatrix = glm::rotate(modelMatrix, angle, glm::vec3(0.f, 0.f, 1.f));
+    modelMatrix[0] = glm::vec4(orientation.x, orientation.y, 0.f, 0.f);
+    modelMatrix[1] = glm::vec4(-orientation.y, orientation.x, 0.f, 0.f);
+    modelMatrix[3] = glm::vec4(position2D.position, 0.f, 1.f);
     return modelMatrix;
 }
 
+bool RefreshTransform(TransformComponent& transform, const PositionComponent& position2D)
+{
+    if (transform.position == position2D.position && transform.orientation == position2D.orientation)
+        return false;
+    transform.position = position2D.position;
+    transform.orientation = position2D.orientation;
+    transform.model = ModelFromComponents(position2D);
+    return true;
+}
+
 } // namespace TransformationHelper
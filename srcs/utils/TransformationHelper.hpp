@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Components/PositionComponent.hpp"
+#include "RenderComponents/TransformComponent.hpp"
 
 #include "hatcher/Maths/glm_pure.hpp"
 
@@ -9,4 +10,7 @@ namespace TransformationHelper
 
 glm::mat4 ModelFromComponents(const PositionComponent& position2D);
 
+// Rebuilds the model matrix only if the position changed since. Returns whether it did.
+bool RefreshTransform(TransformComponent& transform, const PositionComponent& position2D);
+
 } // namespace TransformationHelper
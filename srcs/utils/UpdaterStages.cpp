@@ -0,0 +1,75 @@
+#include "UpdaterStages.hpp"
+
+#include "ThreadPool.hpp"
+
+#include <atomic>
+
+std::vector<UpdaterStage> BuildUpdaterStages(const std::vector<ComponentAccess>& accesses)
+{
+    std::vector<UpdaterStage> stages;
+    std::vector<const ComponentAccess*> graphAccesses;
+    bool graphOpen = false;
+    for (int updater = 0; updater < static_cast<int>(accesses.size()); updater++)
+    {
+        const ComponentAccess& access = accesses[updater];
+        if (access.IsExclusive())
+        {
+            stages.push_back({{updater}, {{}}, {0}});
+            graphOpen = false;
+            continue;
+        }
+
+        if (!graphOpen)
+        {
+            stages.emplace_back();
+            graphAccesses.clear();
+            graphOpen = true;
+        }
+        UpdaterStage& graph = stages.back();
+        const int node = static_cast<int>(graph.updaters.size());
+        graph.updaters.push_back(updater);
+        graph.successors.emplace_back();
+        graph.predecessorCounts.push_back(0);
+        for (int previous = 0; previous < node; previous++)
+        {
+            if (graphAccesses[previous]->ConflictsWith(access))
+            {
+                graph.successors[previous].push_back(node);
+                graph.predecessorCounts[node] += 1;
+            }
+        }
+        graphAccesses.push_back(&access);
+    }
+    return stages;
+}
+
+void RunUpdaterStage(ThreadPool& threadPool, const UpdaterStage& stage, const std::function<void(int)>& runUpdater)
+{
+    const int nodeCount = static_cast<int>(stage.updaters.size());
+    if (nodeCount == 1)
+    {
+        runUpdater(stage.updaters[0]);
+        return;
+    }
+
+    ThreadPool::TaskGroup group;
+    std::vector<std::atomic<int>> remainingPredecessors(nodeCount);
+    for (int node = 0; node < nodeCount; node++)
+        remainingPredecessors[node] = stage.predecessorCounts[node];
+
+    std::function<void(int)> runNode = [&](int node)
+    {
+        runUpdater(stage.updaters[node]);
+        for (int successor : stage.successors[node])
+        {
+            if (--remainingPredecessors[successor] == 0)
+                threadPool.Submit(group, [&runNode, successor]() { runNode(successor); });
+        }
+    };
+    for (int node = 0; node < nodeCount; node++)
+    {
+        if (stage.predecessorCounts[node] == 0)
+            threadPool.Submit(group, [&runNode, node]() { runNode(node); });
+    }
+    threadPool.Wait(group);
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "ScheduledUpdater.hpp"
+
+class ThreadPool;
+
+// Either a lone updater, or a dependency graph between consecutive updaters declaring their access.
+// Within a graph, an updater waits for every earlier one it conflicts with, so the result is the serial one.
+struct UpdaterStage
+{
+    // Indices in the access list the stages were built from.
+    std::vector<int> updaters;
+    std::vector<std::vector<int>> successors;
+    std::vector<int> predecessorCounts;
+};
+
+std::vector<UpdaterStage> BuildUpdaterStages(const std::vector<ComponentAccess>& accesses);
+
+// Calls runUpdater with each updater index of the stage, on the pool threads, once its predecessors are done.
+void RunUpdaterStage(ThreadPool& threadPool, const UpdaterStage& stage, const std::function<void(int)>& runUpdater);
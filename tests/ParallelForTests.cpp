@@ -0,0 +1,74 @@
+#include "Test.hpp"
+
+#include "utils/ParallelFor.hpp"
+
+#include <algorithm>
+
+namespace
+{
+
+constexpr int valueCount = 10000;
+
+// Small terms of decreasing size, so that the float sum depends on the order they are added in.
+float Term(int i)
+{
+    return 1.f / static_cast<float>(i + 1);
+}
+
+float SumTerms(ThreadPool& threadPool)
+{
+    const auto AddTerm = [](int i, float& sum) { sum += Term(i); };
+    const auto Combine = [](float& sum, float chunkSum) { sum += chunkSum; };
+    return ParallelReduce(valueCount, 0.f, AddTerm, Combine, threadPool);
+}
+
+std::vector<int> CollectMultiplesOfSeven(ThreadPool& threadPool)
+{
+    const auto CollectMultiple = [](int i, std::vector<int>& output)
+    {
+        if (i % 7 == 0)
+            output.push_back(i);
+    };
+    return ParallelCollect<int>(valueCount, CollectMultiple, threadPool);
+}
+
+void TestReduceIsDeterministic()
+{
+    float expected = 0.f;
+    for (int chunkIndex = 0; chunkIndex < ParallelChunkCount(valueCount); chunkIndex++)
+    {
+        float chunkSum = 0.f;
+        const int begin = chunkIndex * PARALLEL_CHUNK_SIZE;
+        for (int i = begin; i < std::min(valueCount, begin + PARALLEL_CHUNK_SIZE); i++)
+            chunkSum += Term(i);
+        expected += chunkSum;
+    }
+
+    ThreadPool serialPool(0);
+    ThreadPool parallelPool(3);
+    for (int run = 0; run < 20; run++)
+    {
+        TEST_CHECK(SumTerms(serialPool) == expected);
+        TEST_CHECK(SumTerms(parallelPool) == expected);
+    }
+}
+
+void TestCollectKeepsSerialOrder()
+{
+    std::vector<int> expected;
+    for (int i = 0; i < valueCount; i += 7)
+        expected.push_back(i);
+
+    ThreadPool serialPool(0);
+    ThreadPool parallelPool(3);
+    for (int run = 0; run < 20; run++)
+    {
+        TEST_CHECK(CollectMultiplesOfSeven(serialPool) == expected);
+        TEST_CHECK(CollectMultiplesOfSeven(parallelPool) == expected);
+    }
+}
+
+TestRegisterer reduceRegisterer("ParallelFor: reduce is deterministic", TestReduceIsDeterministic);
+TestRegisterer collectRegisterer("ParallelFor: collect keeps serial order", TestCollectKeepsSerialOrder);
+
+} // namespace
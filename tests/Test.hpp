@@ -0,0 +1,17 @@
+#pragma once
+
+#include <functional>
+
+using TestFunction = std::function<void()>;
+
+void RegisterTest(const char* name, TestFunction function);
+void ReportFailure(const char* file, int line, const char* expression);
+
+class TestRegisterer
+{
+public:
+    TestRegisterer(const char* name, TestFunction function) { RegisterTest(name, std::move(function)); }
+};
+
+// Reports the failure and keeps running the test.
+#define TEST_CHECK(expression) ((expression) ? (void)0 : ReportFailure(__FILE__, __LINE__, #expression))
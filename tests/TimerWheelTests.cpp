@@ -0,0 +1,70 @@
+#include "Test.hpp"
+
+#include "WorldComponents/TimerWheel.hpp"
+
+#include "utils/TimeOfDay.hpp"
+
+#include <algorithm>
+
+namespace
+{
+
+const Entity worker = Entity(7);
+
+// Advances tick by tick until lastTick, included, and returns the ticks the worker's timer fired at.
+std::vector<int> FiringTicks(TimerWheel& timerWheel, int firstTick, int lastTick)
+{
+    std::vector<int> ticks;
+    for (int tick = firstTick; tick <= lastTick; tick++)
+    {
+        timerWheel.Advance(tick);
+        for (Entity entity : timerWheel.TakeDue(ETimerEvent::WorkDone))
+        {
+            TEST_CHECK(entity == worker);
+            ticks.push_back(tick);
+        }
+    }
+    return ticks;
+}
+
+void TestRescheduledTimerFiresAtNewTick(int firstDueTick, int newDueTick)
+{
+    TimerWheel timerWheel(0);
+    const TimerHandle handle = timerWheel.Schedule(firstDueTick, worker, ETimerEvent::WorkDone);
+    const TimerHandle rescheduled = timerWheel.Reschedule(handle, newDueTick);
+
+    TEST_CHECK(!timerWheel.IsScheduled(handle));
+    TEST_CHECK(timerWheel.IsScheduled(rescheduled));
+    TEST_CHECK(FiringTicks(timerWheel, 0, std::max(firstDueTick, newDueTick) + 1) == std::vector<int>{newDueTick});
+    TEST_CHECK(!timerWheel.IsScheduled(rescheduled));
+}
+
+void TestRescheduleLater()
+{
+    TestRescheduledTimerFiresAtNewTick(10, 20);
+    // Across the minute and hour wheels, so that the stale handle is cascaded before the old tick comes.
+    TestRescheduledTimerFiresAtNewTick(10, HoursToTicks(2) + 3);
+}
+
+void TestRescheduleEarlier()
+{
+    TestRescheduledTimerFiresAtNewTick(20, 10);
+    TestRescheduledTimerFiresAtNewTick(HoursToTicks(2) + 3, MinutesToTicks(1) + 5);
+}
+
+void TestRescheduleAfterAdvance()
+{
+    TimerWheel timerWheel(0);
+    TimerHandle handle = timerWheel.Schedule(MinutesToTicks(2), worker, ETimerEvent::WorkDone);
+    TEST_CHECK(FiringTicks(timerWheel, 0, MinutesToTicks(1)).empty());
+    handle = timerWheel.Reschedule(handle, MinutesToTicks(3));
+    TEST_CHECK(FiringTicks(timerWheel, MinutesToTicks(1) + 1, MinutesToTicks(4)) ==
+               std::vector<int>{MinutesToTicks(3)});
+}
+
+TestRegisterer laterRegisterer("TimerWheel: rescheduled later fires only at its new tick", TestRescheduleLater);
+TestRegisterer earlierRegisterer("TimerWheel: rescheduled earlier fires only at its new tick", TestRescheduleEarlier);
+TestRegisterer advanceRegisterer("TimerWheel: rescheduled after advancing fires at its new tick",
+                                 TestRescheduleAfterAdvance);
+
+} // namespace
@@ -0,0 +1,78 @@
+#include "Test.hpp"
+
+#include "utils/ThreadPool.hpp"
+#include "utils/UpdaterStages.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+
+struct ComponentA
+{
+};
+struct ComponentB
+{
+};
+
+void TestStagesFollowDeclaredAccesses()
+{
+    std::vector<ComponentAccess> accesses;
+    accesses.push_back(ComponentAccess().Reads<ComponentA>());
+    accesses.push_back(ComponentAccess().Writes<ComponentA>());
+    accesses.push_back(ComponentAccess().Reads<ComponentB>());
+    accesses.push_back(ComponentAccess::Exclusive());
+    accesses.push_back(ComponentAccess().Reads<ComponentA>());
+
+    const std::vector<UpdaterStage> stages = BuildUpdaterStages(accesses);
+    TEST_CHECK(stages.size() == 3);
+    TEST_CHECK((stages[0].updaters == std::vector<int>{0, 1, 2}));
+    TEST_CHECK((stages[0].successors[0] == std::vector<int>{1}));
+    TEST_CHECK(stages[0].successors[1].empty());
+    TEST_CHECK(stages[0].successors[2].empty());
+    TEST_CHECK((stages[0].predecessorCounts == std::vector<int>{0, 1, 0}));
+    TEST_CHECK((stages[1].updaters == std::vector<int>{3}));
+    TEST_CHECK((stages[2].updaters == std::vector<int>{4}));
+}
+
+// The reader declared after the writer must always see it done, however the pool schedules them.
+void TestConflictingAccessesAreSerialized()
+{
+    std::vector<ComponentAccess> accesses;
+    accesses.push_back(ComponentAccess().Writes<ComponentA>());
+    accesses.push_back(ComponentAccess().Reads<ComponentB>());
+    accesses.push_back(ComponentAccess().Reads<ComponentA>());
+    const std::vector<UpdaterStage> stages = BuildUpdaterStages(accesses);
+    TEST_CHECK(stages.size() == 1);
+
+    ThreadPool threadPool(3);
+    for (int run = 0; run < 200; run++)
+    {
+        std::atomic<int> step = 0;
+        std::atomic<int> writerEnd = -1;
+        std::atomic<int> readerStart = -1;
+        std::atomic<int> updateCount = 0;
+        RunUpdaterStage(threadPool, stages[0],
+                        [&](int updater)
+                        {
+                            if (updater == 0)
+                            {
+                                std::this_thread::sleep_for(std::chrono::microseconds(50));
+                                writerEnd = step++;
+                            }
+                            else if (updater == 2)
+                                readerStart = step++;
+                            updateCount++;
+                        });
+        TEST_CHECK(updateCount == 3);
+        TEST_CHECK(writerEnd >= 0 && readerStart > writerEnd);
+    }
+}
+
+TestRegisterer stagesRegisterer("UpdaterStages: stages follow declared accesses", TestStagesFollowDeclaredAccesses);
+TestRegisterer serializedRegisterer("UpdaterStages: conflicting accesses are serialized",
+                                    TestConflictingAccessesAreSerialized);
+
+} // namespace
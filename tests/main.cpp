@@ -0,0 +1,50 @@
+#include "Test.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace
+{
+
+struct Test
+{
+    const char* name;
+    TestFunction function;
+};
+
+std::vector<Test>& Tests()
+{
+    static std::vector<Test> tests;
+    return tests;
+}
+
+int failureCount = 0;
+
+} // namespace
+
+void RegisterTest(const char* name, TestFunction function)
+{
+    Tests().push_back({name, std::move(function)});
+}
+
+void ReportFailure(const char* file, int line, const char* expression)
+{
+    std::cerr << file << ':' << line << ": check failed: " << expression << std::endl;
+    failureCount++;
+}
+
+int main()
+{
+    int failedTests = 0;
+    for (const Test& test : Tests())
+    {
+        const int previousFailureCount = failureCount;
+        test.function();
+        const bool passed = failureCount == previousFailureCount;
+        std::cout << (passed ? "[ OK ] " : "[FAIL] ") << test.name << std::endl;
+        if (!passed)
+            failedTests++;
+    }
+    std::cout << Tests().size() - failedTests << '/' << Tests().size() << " tests passed." << std::endl;
+    return failedTests == 0 ? 0 : 1;
+}